@@ -0,0 +1,144 @@
+#include "agrupacion.h"
+#include "diccionario.h"
+#include <algorithm> // std::sort, std::max
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+// Acumulador de un grupo dentro de una tabla parcial
+struct Acumulador {
+    unsigned long long personas = 0;
+    double sumaIngresos = 0;
+    unsigned long long declarantes = 0;
+};
+
+const std::string CLAVE_DESCONOCIDA = "Desconocido";
+
+// Milisegundos transcurridos desde 'inicio'
+double msDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+} // namespace
+
+/**
+ * Implementación de agruparPersonas.
+ *
+ * POR QUÉ: Un mapa compartido con mutex serializaría a todos los hilos.
+ * CÓMO: Las claves posibles son pocas y densas (códigos del diccionario o años),
+ *       así que cada tabla parcial es un vector indexado por posición; la última
+ *       posición es el grupo "Desconocido". Fases: recorrido paralelo, fusión y
+ *       armado del resultado, cada una cronometrada.
+ * PARA QUÉ: Desgloses en una sola pasada por la colección.
+ */
+ResultadoAgrupacion agruparPersonas(const std::vector<Persona>& personas,
+                                    CriterioGrupo criterio, unsigned hilos, const MapaBajas* bajas) {
+    const size_t BLOQUE = 1 << 16; // Filas por bloque de trabajo
+    const size_t total = personas.size();
+    const bool porCiudad = (criterio == CriterioGrupo::Ciudad);
+
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Todas las personas tienen códigos ya internados, menores que el tamaño actual
+    const size_t numClaves = porCiudad ? Diccionario::global().size()
+                                       : static_cast<size_t>(ANIO_MAXIMO - ANIO_MINIMO);
+    const size_t desconocido = numClaves; // Posición del grupo "Desconocido"
+
+    ResultadoAgrupacion resultado;
+    resultado.hilos = hilos;
+
+    // Fase 1: recorrido paralelo, una tabla parcial por hilo
+    auto inicio = std::chrono::steady_clock::now();
+    std::vector<std::vector<Acumulador>> parciales(hilos);
+    std::atomic<size_t> siguienteBloque(0);
+
+    auto trabajador = [&](unsigned h) {
+        std::vector<Acumulador> tabla(numClaves + 1);
+        for (;;) {
+            size_t desde = siguienteBloque.fetch_add(BLOQUE);
+            if (desde >= total) {
+                break;
+            }
+            size_t hasta = std::min(desde + BLOQUE, total);
+            for (size_t i = desde; i < hasta; ++i) {
+                if (bajas && bajas->eliminada(i)) {
+                    continue;
+                }
+                const Persona& p = personas[i];
+                size_t posicion;
+                if (porCiudad) {
+                    uint32_t codigo = p.getCodigoCiudad(); // El código 0 es el texto vacío
+                    posicion = codigo != 0 ? codigo : desconocido;
+                } else {
+                    int anio = p.getFechaNacimiento().anio(); // Fecha nula: año 0, "Desconocido"
+                    posicion = (anio >= ANIO_MINIMO && anio < ANIO_MAXIMO)
+                        ? static_cast<size_t>(anio - ANIO_MINIMO) : desconocido;
+                }
+                Acumulador& a = tabla[posicion < numClaves ? posicion : desconocido];
+                ++a.personas;
+                a.sumaIngresos += p.getIngresosAnuales();
+                a.declarantes += p.getDeclaranteRenta();
+            }
+        }
+        parciales[h] = std::move(tabla); // Única escritura compartida: la ranura propia
+    };
+
+    std::vector<std::thread> grupo;
+    for (unsigned h = 1; h < hilos; ++h) {
+        grupo.emplace_back(trabajador, h);
+    }
+    trabajador(0); // El hilo principal también trabaja
+    for (auto& t : grupo) {
+        t.join();
+    }
+    resultado.tiempoRecorrido = msDesde(inicio);
+
+    // Fase 2: fusión de las tablas parciales sobre la del hilo 0
+    inicio = std::chrono::steady_clock::now();
+    std::vector<Acumulador>& fusion = parciales[0];
+    for (unsigned h = 1; h < hilos; ++h) {
+        for (size_t k = 0; k <= numClaves; ++k) {
+            fusion[k].personas += parciales[h][k].personas;
+            fusion[k].sumaIngresos += parciales[h][k].sumaIngresos;
+            fusion[k].declarantes += parciales[h][k].declarantes;
+        }
+    }
+    resultado.tiempoFusion = msDesde(inicio);
+
+    // Fase 3: grupos no vacíos con su clave legible, ordenados
+    inicio = std::chrono::steady_clock::now();
+    for (size_t k = 0; k <= numClaves; ++k) {
+        const Acumulador& a = fusion[k];
+        if (a.personas == 0) {
+            continue;
+        }
+        Grupo g;
+        if (k == desconocido) {
+            g.clave = CLAVE_DESCONOCIDA;
+        } else if (porCiudad) {
+            g.clave = Diccionario::global().texto(static_cast<uint32_t>(k));
+        } else {
+            g.clave = std::to_string(ANIO_MINIMO + static_cast<int>(k));
+        }
+        g.personas = a.personas;
+        g.sumaIngresos = a.sumaIngresos;
+        g.declarantes = a.declarantes;
+        resultado.grupos.push_back(std::move(g));
+    }
+    std::sort(resultado.grupos.begin(), resultado.grupos.end(),
+              [](const Grupo& a, const Grupo& b) {
+                  bool aDesconocido = (a.clave == CLAVE_DESCONOCIDA);
+                  bool bDesconocido = (b.clave == CLAVE_DESCONOCIDA);
+                  if (aDesconocido != bDesconocido) {
+                      return bDesconocido;
+                  }
+                  return a.clave < b.clave;
+              });
+    resultado.tiempoResultado = msDesde(inicio);
+
+    return resultado;
+}
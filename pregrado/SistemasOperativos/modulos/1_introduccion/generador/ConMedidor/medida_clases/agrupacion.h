@@ -0,0 +1,60 @@
+#ifndef AGRUPACION_H
+#define AGRUPACION_H
+
+#include "persona.h"
+#include "mapa_bajas.h"
+#include <string>
+#include <vector>
+
+/**
+ * Criterio de agrupación de la colección.
+ */
+enum class CriterioGrupo { Ciudad, AnioNacimiento };
+
+// Rango de años con grupo propio; los demás (o fechas inválidas) van a "Desconocido"
+const int ANIO_MINIMO = 1900;
+const int ANIO_MAXIMO = 2100; // Exclusivo
+
+/**
+ * Agregados de un grupo.
+ */
+struct Grupo {
+    std::string clave;                   // Ciudad o año
+    unsigned long long personas = 0;     // Número de personas del grupo
+    double sumaIngresos = 0;             // Suma de ingresos anuales
+    unsigned long long declarantes = 0;  // Declarantes de renta del grupo
+
+    double promedioIngresos() const { return personas ? sumaIngresos / personas : 0; }
+    double proporcionDeclarantes() const { return personas ? double(declarantes) / personas : 0; }
+};
+
+/**
+ * Resultado de una agrupación con el tiempo de cada fase.
+ */
+struct ResultadoAgrupacion {
+    std::vector<Grupo> grupos;   // Grupos no vacíos ordenados por clave ("Desconocido" al final)
+    unsigned hilos = 0;          // Hilos usados en el recorrido
+    double tiempoRecorrido = 0;  // ms: recorrido paralelo con tablas parciales por hilo
+    double tiempoFusion = 0;     // ms: suma de las tablas parciales
+    double tiempoResultado = 0;  // ms: armado y orden de los grupos
+};
+
+/**
+ * Agrupa la colección por ciudad o por año de nacimiento.
+ *
+ * POR QUÉ: Los desgloses (conteo, ingresos, proporción de declarantes) por
+ *          ciudad o año requieren recorrer toda la colección.
+ * CÓMO: Cada hilo toma bloques de filas de un contador atómico y acumula en su
+ *       propia tabla parcial densa (indexada por código de ciudad del
+ *       Diccionario o por año); al final el hilo principal suma las tablas.
+ *       Ningún hilo escribe en memoria compartida durante el recorrido.
+ * PARA QUÉ: Escalar con los núcleos sin cerrojos ni contención.
+ *
+ * @param hilos Número de hilos (0 = todos los núcleos).
+ * @param bajas Filas eliminadas que se omiten (nullptr = ninguna).
+ */
+ResultadoAgrupacion agruparPersonas(const std::vector<Persona>& personas,
+                                    CriterioGrupo criterio, unsigned hilos,
+                                    const MapaBajas* bajas = nullptr);
+
+#endif // AGRUPACION_H
@@ -0,0 +1,178 @@
+#include "coleccion_mapeada.h"
+#include "generador.h"   // MotorAleatorio, generarPersona, ID_INICIAL
+#include <atomic>        // std::atomic (reparto de bloques entre hilos)
+#include <cstdio>        // std::perror
+#include <cstring>       // std::strerror
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <fcntl.h>       // open, posix_fallocate, posix_fadvise
+#include <unistd.h>      // close, unlink, sysconf
+
+namespace {
+
+// Tamaño de página del sistema (alineación que exige madvise)
+size_t tamPagina() {
+    static const size_t pagina = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pagina;
+}
+
+} // namespace
+
+ColeccionMapeada::~ColeccionMapeada() {
+    cerrar();
+}
+
+void ColeccionMapeada::cerrar() {
+    if (mapeo) {
+        munmap(mapeo, largo);
+    }
+    if (fd >= 0) {
+        close(fd); // Último uso del archivo ya borrado: el sistema libera su espacio
+    }
+    fd = -1;
+    mapeo = nullptr;
+    largo = 0;
+    n = 0;
+    registros = nullptr;
+}
+
+/**
+ * Implementación de crear.
+ *
+ * POR QUÉ: Generar directamente en el archivo, sin un vector intermedio.
+ * CÓMO: open + posix_fallocate + mmap(MAP_SHARED) y unlink del nombre. Los hilos
+ *       toman bloques de un contador atómico; el registro i sale de
+ *       generarPersona(semillaRegistro(semilla, i), ID_INICIAL + i) y se guarda en
+ *       su posición. Al terminar un bloque, MADV_DONTNEED lo saca del proceso
+ *       (con MAP_SHARED las páginas sucias quedan en el caché hasta escribirse).
+ * PARA QUÉ: Memoria residente acotada mientras se generan cientos de millones.
+ */
+bool ColeccionMapeada::crear(const std::string& ruta, size_t n, uint64_t semilla, unsigned hilos) {
+    cerrar();
+    if (n == 0) {
+        return false;
+    }
+
+    int descriptor = open(ruta.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (descriptor < 0) {
+        std::perror(("Error al abrir " + ruta).c_str());
+        return false;
+    }
+    const size_t tamano = n * sizeof(RegistroMapeado);
+    int error = posix_fallocate(descriptor, 0, static_cast<off_t>(tamano));
+    if (error != 0) {
+        std::cerr << "No se pudieron reservar " << tamano / (1024 * 1024) << " MB en " << ruta
+                  << ": " << std::strerror(error) << "\n";
+        close(descriptor);
+        unlink(ruta.c_str());
+        return false;
+    }
+    void* direccion = mmap(nullptr, tamano, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    unlink(ruta.c_str()); // Archivo de trabajo: vive mientras siga abierto y mapeado
+    if (direccion == MAP_FAILED) {
+        std::perror("Error en mmap");
+        close(descriptor);
+        return false;
+    }
+    fd = descriptor;
+    mapeo = direccion;
+    largo = tamano;
+    this->n = n;
+    registros = static_cast<RegistroMapeado*>(mapeo);
+
+    const size_t BLOQUE = 1 << 16; // Registros por bloque de trabajo
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::atomic<size_t> siguienteBloque(0);
+
+    auto trabajador = [&]() {
+        for (;;) {
+            size_t inicio = siguienteBloque.fetch_add(BLOQUE);
+            if (inicio >= n) {
+                break;
+            }
+            size_t fin = std::min(inicio + BLOQUE, n);
+            for (size_t i = inicio; i < fin; ++i) {
+                MotorAleatorio motor(semillaRegistro(semilla, i));
+                const long numeroId = ID_INICIAL + static_cast<long>(i);
+                Persona p = generarPersona(motor, numeroId);
+                RegistroMapeado& r = registros[i];
+                r.id = static_cast<uint64_t>(numeroId);
+                r.nombre = p.getCodigoNombre();
+                r.apellido = p.getCodigoApellido();
+                r.ciudadNacimiento = p.getCodigoCiudad();
+                r.fechaNacimiento = p.getFechaNacimiento().getCodigo();
+                r.ingresosAnuales = p.getIngresosAnuales();
+                r.patrimonio = p.getPatrimonio();
+                r.deudas = p.getDeudas();
+                r.declaranteRenta = p.getDeclaranteRenta() ? 1 : 0;
+                std::fill(r.relleno, r.relleno + sizeof(r.relleno), 0);
+            }
+            aconsejar(inicio, fin, MADV_DONTNEED);
+        }
+    };
+
+    std::vector<std::thread> grupo;
+    for (unsigned h = 1; h < hilos; ++h) {
+        grupo.emplace_back(trabajador);
+    }
+    trabajador(); // El hilo principal también trabaja
+    for (auto& t : grupo) {
+        t.join();
+    }
+    return true;
+}
+
+Persona ColeccionMapeada::persona(size_t i) const {
+    const RegistroMapeado& r = registros[i];
+    return Persona(r.nombre, r.apellido, std::to_string(r.id), r.ciudadNacimiento,
+                   Fecha::desdeCodigo(r.fechaNacimiento), r.ingresosAnuales,
+                   r.patrimonio, r.deudas, r.declaranteRenta != 0);
+}
+
+void ColeccionMapeada::prepararBusquedas() const {
+    aconsejar(0, n, MADV_RANDOM);
+}
+
+long ColeccionMapeada::buscarPorID(uint64_t id) const {
+    if (n == 0 || id < registros[0].id) {
+        return -1;
+    }
+    uint64_t directa = id - registros[0].id;
+    if (directa < n && registros[directa].id == id) {
+        return static_cast<long>(directa);
+    }
+    size_t bajo = 0, alto = n;
+    while (bajo < alto) {
+        size_t medio = bajo + (alto - bajo) / 2;
+        if (registros[medio].id < id) {
+            bajo = medio + 1;
+        } else {
+            alto = medio;
+        }
+    }
+    return (bajo < n && registros[bajo].id == id) ? static_cast<long>(bajo) : -1;
+}
+
+void ColeccionMapeada::liberarCache() const {
+    if (!mapeo) {
+        return;
+    }
+    msync(mapeo, largo, MS_SYNC);           // Las páginas sucias no se pueden descartar
+    madvise(mapeo, largo, MADV_DONTNEED);   // Fuera del proceso...
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED); // ...y fuera del caché de páginas
+}
+
+void ColeccionMapeada::aconsejar(size_t desde, size_t hasta, int consejo) const {
+    const size_t pagina = tamPagina();
+    const size_t inicio = desde * sizeof(RegistroMapeado) / pagina * pagina;
+    size_t fin = hasta * sizeof(RegistroMapeado);
+    if (consejo == MADV_DONTNEED && fin < largo) {
+        fin = fin / pagina * pagina; // La página parcial del final sigue en uso
+    }
+    if (fin > inicio) {
+        madvise(static_cast<char*>(mapeo) + inicio, fin - inicio, consejo);
+    }
+}
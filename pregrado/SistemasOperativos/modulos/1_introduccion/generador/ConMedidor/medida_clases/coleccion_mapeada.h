@@ -0,0 +1,157 @@
+#ifndef COLECCION_MAPEADA_H
+#define COLECCION_MAPEADA_H
+
+#include "persona.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <sys/mman.h> // MADV_* (usados por recorrer)
+
+/**
+ * Persona de tamaño fijo tal como se guarda en el archivo mapeado.
+ *
+ * Los textos son códigos del Diccionario global (como en Persona) y la cédula
+ * es numérica, así que el registro no apunta a memoria del montículo.
+ */
+struct RegistroMapeado {
+    uint64_t id;                // Número de cédula
+    uint32_t nombre;            // Códigos del Diccionario global
+    uint32_t apellido;
+    uint32_t ciudadNacimiento;
+    uint32_t fechaNacimiento;   // Código de Fecha
+    double ingresosAnuales;
+    double patrimonio;
+    double deudas;
+    uint8_t declaranteRenta;
+    uint8_t relleno[7];         // Mantiene el registro alineado a 8 bytes
+};
+
+/**
+ * Colección de personas en un archivo proyectado con mmap (fuera de memoria).
+ *
+ * POR QUÉ: generarColeccion() guarda todo en un std::vector; con cientos de
+ *          millones de personas la reserva supera la RAM y termina en bad_alloc.
+ * CÓMO: Los registros viven en un archivo de trabajo mapeado con MAP_SHARED; el
+ *       sistema operativo trae y desaloja páginas según se usan. Los recorridos
+ *       avanzan por ventanas: piden por adelantado la siguiente (MADV_WILLNEED)
+ *       y sueltan la anterior (MADV_DONTNEED), así la memoria residente queda
+ *       acotada a unas dos ventanas. Las búsquedas puntuales usan MADV_RANDOM
+ *       para no leer por adelantado páginas que no se van a usar.
+ * PARA QUÉ: Analizar colecciones más grandes que la RAM (500M personas ocupan
+ *           500M x 56 bytes = 26 GB de archivo) con memoria residente constante.
+ *
+ * El archivo se borra del directorio al crearlo y su espacio se libera al
+ * cerrar: los códigos del Diccionario solo valen dentro de este proceso.
+ */
+class ColeccionMapeada {
+public:
+    static const size_t VENTANA = 64 << 20; // Bytes por ventana de un recorrido
+
+    ColeccionMapeada() = default;
+    ~ColeccionMapeada();
+    ColeccionMapeada(const ColeccionMapeada&) = delete;
+    ColeccionMapeada& operator=(const ColeccionMapeada&) = delete;
+
+    /**
+     * Crea el archivo de trabajo y genera en él n personas usando varios hilos.
+     *
+     * POR QUÉ: La colección no debe pasar nunca completa por la memoria del proceso.
+     * CÓMO: Reserva el espacio con posix_fallocate (un disco lleno da un error aquí
+     *       y no un SIGBUS al escribir), mapea el archivo y reparte bloques de
+     *       registros entre los hilos como agregarPersonasParalelo. Cada hilo suelta
+     *       las páginas de un bloque al terminarlo; el kernel las escribe al disco.
+     * PARA QUÉ: Mismos datos que generarColeccionParalela(n, semilla, hilos).
+     *
+     * @param ruta Archivo de trabajo (se crea o se trunca).
+     * @param hilos Número de hilos (0 = todos los núcleos disponibles).
+     * @return false si no se pudo crear, reservar o mapear el archivo.
+     */
+    bool crear(const std::string& ruta, size_t n, uint64_t semilla, unsigned hilos);
+    void cerrar();
+
+    size_t size() const { return n; }
+    bool empty() const { return n == 0; }
+    size_t bytes_mapeados() const { return largo; }
+
+    const RegistroMapeado& operator[](size_t i) const { return registros[i]; }
+    Persona persona(size_t i) const; // Copia el registro i como Persona
+
+    /**
+     * Recorre todos los registros en orden y llama visitar(const RegistroMapeado&).
+     *
+     * CÓMO: Con 'conConsejos', marca la región MADV_SEQUENTIAL y avanza por ventanas
+     *       de VENTANA bytes: pide la siguiente con MADV_WILLNEED antes de visitar
+     *       la actual y suelta la actual con MADV_DONTNEED al terminarla. Al final
+     *       vuelve a MADV_NORMAL. Sin 'conConsejos' solo marca MADV_NORMAL (la lectura
+     *       anticipada por defecto del kernel) y lee: referencia para comparar.
+     */
+    template <typename Visitar>
+    void recorrer(Visitar visitar, bool conConsejos = true) const;
+
+    /**
+     * Marca la región MADV_RANDOM antes de una serie de búsquedas puntuales.
+     *
+     * POR QUÉ: La lectura anticipada del kernel trae páginas vecinas que una
+     *          búsqueda aleatoria no usa y que desalojan otras útiles.
+     * CÓMO: Un solo madvise para toda la serie (no uno por búsqueda); el próximo
+     *       recorrer() la devuelve a MADV_NORMAL.
+     */
+    void prepararBusquedas() const;
+
+    /**
+     * Busca una persona por cédula.
+     *
+     * CÓMO: Las cédulas son consecutivas desde la primera, así que se prueba la
+     *       posición directa (una sola página); si no coincide, búsqueda binaria
+     *       (las cédulas están ordenadas).
+     * @return Posición encontrada o -1.
+     */
+    long buscarPorID(uint64_t id) const;
+
+    /**
+     * Escribe las páginas modificadas y las saca de la memoria y del caché de páginas.
+     *
+     * POR QUÉ: Recién generado, el archivo completo sigue en el caché y un recorrido
+     *          no tendría fallos mayores: mediría la RAM, no el disco.
+     * CÓMO: msync(MS_SYNC), MADV_DONTNEED sobre el mapeo y posix_fadvise(POSIX_FADV_DONTNEED).
+     * PARA QUÉ: Medir en frío, como cuando la colección no cabe en memoria.
+     */
+    void liberarCache() const;
+
+private:
+    // madvise sobre las páginas de los registros [desde, hasta). MADV_DONTNEED no
+    // suelta la página parcial del final (la comparte el registro siguiente).
+    void aconsejar(size_t desde, size_t hasta, int consejo) const;
+
+    int fd = -1;                         // Descriptor del archivo de trabajo
+    void* mapeo = nullptr;               // Dirección devuelta por mmap
+    size_t largo = 0;                    // Bytes mapeados
+    size_t n = 0;                        // Número de registros
+    RegistroMapeado* registros = nullptr;
+};
+
+// --- Implementación inline ---
+
+template <typename Visitar>
+void ColeccionMapeada::recorrer(Visitar visitar, bool conConsejos) const {
+    const size_t porVentana = VENTANA / sizeof(RegistroMapeado);
+    aconsejar(0, n, conConsejos ? MADV_SEQUENTIAL : MADV_NORMAL);
+    for (size_t inicio = 0; inicio < n; inicio += porVentana) {
+        const size_t fin = std::min(n, inicio + porVentana);
+        if (conConsejos && fin < n) {
+            aconsejar(fin, std::min(n, fin + porVentana), MADV_WILLNEED);
+        }
+        for (size_t i = inicio; i < fin; ++i) {
+            visitar(static_cast<const RegistroMapeado&>(registros[i]));
+        }
+        if (conConsejos) {
+            aconsejar(inicio, fin, MADV_DONTNEED);
+        }
+    }
+    if (conConsejos) {
+        aconsejar(0, n, MADV_NORMAL);
+    }
+}
+
+#endif // COLECCION_MAPEADA_H
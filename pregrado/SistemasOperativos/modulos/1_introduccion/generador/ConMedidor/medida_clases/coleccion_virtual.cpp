@@ -0,0 +1,35 @@
+#include "coleccion_virtual.h"
+#include "generador.h"
+#include "indice_id.h"
+
+/**
+ * Implementación de operator[].
+ *
+ * POR QUÉ: Obtener cualquier registro sin materializar los anteriores.
+ * CÓMO: Motor propio del registro + generarPersona con cédula ID_INICIAL + i.
+ * PARA QUÉ: Acceso aleatorio O(1) en tiempo y memoria.
+ */
+Persona ColeccionVirtual::operator[](uint64_t i) const {
+    MotorAleatorio motor(semillaRegistro(semilla, i));
+    return generarPersona(motor, ID_INICIAL + static_cast<long>(i));
+}
+
+/**
+ * Implementación de posicionDeID.
+ *
+ * POR QUÉ: Buscar por ID en una colección que no existe en memoria.
+ * CÓMO: Invierte el esquema secuencial de generarID (cédula = ID_INICIAL + i).
+ * PARA QUÉ: Búsqueda por ID en O(1) sin índice.
+ */
+bool ColeccionVirtual::posicionDeID(const std::string& id, uint64_t& posicion) const {
+    uint64_t cedula;
+    if (!IndiceID::convertirCedula(id, cedula) || cedula < static_cast<uint64_t>(ID_INICIAL)) {
+        return false;
+    }
+    uint64_t i = cedula - static_cast<uint64_t>(ID_INICIAL);
+    if (i >= n) {
+        return false;
+    }
+    posicion = i;
+    return true;
+}
@@ -0,0 +1,53 @@
+#ifndef COLECCION_VIRTUAL_H
+#define COLECCION_VIRTUAL_H
+
+#include "persona.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * Colección virtual (perezosa) de personas.
+ *
+ * POR QUÉ: Las pruebas de carga necesitan miles de millones de registros, pero
+ *          nunca todos a la vez en memoria.
+ * CÓMO: No guarda registros: la persona i se calcula al pedirla a partir de
+ *       (semilla, i) con un generador basado en contador (SplitMix64), usando
+ *       la misma lógica de campos que generarPersona.
+ * PARA QUÉ: Acceso aleatorio O(1) en memoria a colecciones de cualquier tamaño.
+ *           Con la misma semilla produce exactamente los registros de
+ *           generarColeccionParalela.
+ */
+class ColeccionVirtual {
+public:
+    ColeccionVirtual(uint64_t n, uint64_t semilla) : n(n), semilla(semilla) {}
+
+    uint64_t size() const { return n; }
+    bool empty() const { return n == 0; }
+    uint64_t getSemilla() const { return semilla; }
+
+    // Agrega 'extra' registros al final: como se calculan bajo demanda, el costo es O(1)
+    void crecer(uint64_t extra) { n += extra; }
+
+    /**
+     * Calcula la persona en la posición i.
+     *
+     * CÓMO: Crea un motor con semillaRegistro(semilla, i) y llama a generarPersona.
+     * @return La persona materializada (copia temporal).
+     */
+    Persona operator[](uint64_t i) const;
+
+    /**
+     * Convierte un ID en la posición del registro.
+     *
+     * POR QUÉ: Los IDs son secuenciales (ID_INICIAL + i), así que no hace falta buscar.
+     * CÓMO: Convierte el ID a número, resta ID_INICIAL y valida el rango.
+     * @return true si el ID pertenece a la colección.
+     */
+    bool posicionDeID(const std::string& id, uint64_t& posicion) const;
+
+private:
+    uint64_t n;       // Número de registros virtuales
+    uint64_t semilla; // Semilla de la colección
+};
+
+#endif // COLECCION_VIRTUAL_H
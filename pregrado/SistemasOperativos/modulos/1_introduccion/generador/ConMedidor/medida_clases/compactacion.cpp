@@ -0,0 +1,47 @@
+#include "compactacion.h"
+#include <chrono>
+#include <functional> // std::cref
+
+/**
+ * Implementación de compactar.
+ *
+ * POR QUÉ: Volver a una colección densa: filas contiguas e índices sin tramos.
+ * CÓMO: Reserva el tamaño final, copia en orden las filas vivas (las cédulas y el
+ *       orden relativo se conservan) y construye los índices desde cero.
+ * PARA QUÉ: Que tras la compactación todo cueste lo mismo que en una colección
+ *           recién generada. Mientras dura, conviven la colección vieja y la nueva.
+ */
+ColeccionCompactada compactar(const std::vector<Persona>& personas, const MapaBajas& bajas) {
+    auto inicio = std::chrono::steady_clock::now();
+    ColeccionCompactada c;
+    c.personas.reserve(personas.size() - bajas.size());
+    for (size_t i = 0; i < personas.size(); ++i) {
+        if (!bajas.eliminada(i)) {
+            c.personas.push_back(personas[i]);
+        }
+    }
+    c.descartadas = personas.size() - c.personas.size();
+
+    c.indiceID.construir(c.personas);
+    for (int campo = 0; campo < 3; ++campo) {
+        c.indicesRango[campo].construir(c.personas, static_cast<CampoFinanciero>(campo));
+    }
+    c.tiempo = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+    return c;
+}
+
+bool Compactador::iniciar(const std::vector<Persona>& personas, const MapaBajas& bajas) {
+    if (enCurso()) {
+        return false;
+    }
+    resultado = std::async(std::launch::async, compactar, std::cref(personas), std::cref(bajas));
+    return true;
+}
+
+bool Compactador::terminada() const {
+    return enCurso() && resultado.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+ColeccionCompactada Compactador::recoger() {
+    return resultado.get(); // get() deja el future sin estado: enCurso() pasa a false
+}
@@ -0,0 +1,68 @@
+#ifndef COMPACTACION_H
+#define COMPACTACION_H
+
+#include "persona.h"
+#include "indice_id.h"
+#include "indice_rango.h"
+#include "mapa_bajas.h"
+#include <future>
+#include <vector>
+
+// Fracción de filas eliminadas a partir de la cual se compacta en segundo plano
+const double UMBRAL_COMPACTACION = 0.10;
+
+/**
+ * Colección densa (sin filas eliminadas) con sus índices ya construidos.
+ */
+struct ColeccionCompactada {
+    std::vector<Persona> personas;
+    IndiceID indiceID;
+    IndiceRango indicesRango[3];
+    size_t descartadas = 0; // Filas eliminadas que no se copiaron
+    double tiempo = 0.0;    // Duración de la compactación en ms
+};
+
+/**
+ * Copia las filas vivas y reconstruye los índices sobre la copia.
+ *
+ * POR QUÉ: Las lápidas y los tramos de bajas hacen más lentos los recorridos y
+ *          las consultas a medida que se acumulan.
+ * CÓMO: Solo lee 'personas' y 'bajas'; el resultado es independiente de ellos.
+ * PARA QUÉ: Poder ejecutarse en otro hilo mientras el menú sigue consultando la
+ *           colección actual.
+ */
+ColeccionCompactada compactar(const std::vector<Persona>& personas, const MapaBajas& bajas);
+
+/**
+ * Compactación en segundo plano.
+ *
+ * POR QUÉ: Compactar 50M personas toma segundos; el menú no debe esperar.
+ * CÓMO: compactar() corre en un hilo aparte (std::async) y el hilo del menú
+ *       instala el resultado entre dos opciones. Mientras corre, la colección
+ *       y el mapa de bajas solo se leen: las opciones que los modifican deben
+ *       recoger antes el resultado.
+ * PARA QUÉ: Consultas sin bloqueo durante la compactación.
+ */
+class Compactador {
+public:
+    /**
+     * Lanza la compactación en otro hilo.
+     *
+     * @return false si ya hay una en curso.
+     */
+    bool iniciar(const std::vector<Persona>& personas, const MapaBajas& bajas);
+
+    // true desde iniciar hasta recoger
+    bool enCurso() const { return resultado.valid(); }
+
+    // true si hay un resultado listo para instalar (no bloquea)
+    bool terminada() const;
+
+    // Espera a que termine y entrega el resultado
+    ColeccionCompactada recoger();
+
+private:
+    std::future<ColeccionCompactada> resultado;
+};
+
+#endif // COMPACTACION_H
@@ -0,0 +1,59 @@
+#ifndef CONSULTA_FECHA_H
+#define CONSULTA_FECHA_H
+
+#include "persona.h"
+#include "fecha.h"
+#include "mapa_bajas.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Cuenta las personas nacidas dentro de 'rango'.
+ *
+ * POR QUÉ: Filtrar por edad o por fecha de nacimiento es una consulta frecuente.
+ * CÓMO: Dos comparaciones de enteros por persona sobre el código de la Fecha;
+ *       el resultado de la comparación se suma sin saltos. Omite las filas de 'bajas'.
+ * PARA QUÉ: Recorrer millones de personas sin leer ni armar texto.
+ *
+ * @param primeras Si no es nullptr, recibe las primeras 'limite' filas que cumplen.
+ * @return Número de personas dentro del rango.
+ */
+size_t contarNacidosEn(const std::vector<Persona>& personas, const RangoFechas& rango,
+                       const MapaBajas* bajas = nullptr,
+                       std::vector<size_t>* primeras = nullptr, size_t limite = 0);
+
+/**
+ * Referencia con la fecha guardada como texto "D/M/AAAA".
+ *
+ * POR QUÉ: Mide lo que costaba la misma consulta con la representación anterior.
+ * CÓMO: Lee cada texto con Fecha::desdeTexto (from_chars, sin asignaciones: el
+ *       mejor caso posible para el texto) y compara el resultado.
+ * PARA QUÉ: Comparar el rendimiento de la consulta entre ambas representaciones.
+ */
+size_t contarNacidosEnTexto(const std::vector<std::string>& fechas, const RangoFechas& rango,
+                            const MapaBajas* bajas = nullptr);
+
+/**
+ * Tiempos de generar las mismas fechas con cada representación.
+ */
+struct ComparacionGeneracionFechas {
+    double tiempoTexto = 0;         // ms: to_string y concatenaciones ("D/M/AAAA")
+    double tiempoBinario = 0;       // ms: Fecha empaquetada
+    size_t bytesTexto = 0;          // sizeof(std::string) más el montículo de los textos largos
+    size_t bytesBinario = 0;        // sizeof(Fecha) por fecha
+    size_t diferencias = 0;         // Fechas cuyo texto no corresponde al código (debe ser 0)
+};
+
+/**
+ * Genera 'n' fechas aleatorias como texto y como Fecha con la misma semilla.
+ *
+ * POR QUÉ: Cuantificar cuánto cuesta armar el texto en la generación.
+ * CÓMO: Dos pasadas con motores idénticos (mismos días, meses y años): una arma
+ *       el texto como lo hacía generarFechaNacimiento y la otra empaqueta la Fecha.
+ *       Al final verifica que cada texto se lea como su Fecha.
+ * PARA QUÉ: Medir la ganancia en la generación independientemente del resto de Persona.
+ */
+ComparacionGeneracionFechas compararGeneracionFechas(size_t n, uint64_t semilla);
+
+#endif // CONSULTA_FECHA_H
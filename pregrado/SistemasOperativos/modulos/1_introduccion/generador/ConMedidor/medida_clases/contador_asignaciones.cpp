@@ -0,0 +1,40 @@
+#include "contador_asignaciones.h"
+#include <atomic>
+#include <cstdlib>  // std::malloc, std::free
+#include <new>
+
+namespace {
+
+std::atomic<bool> contando(false);               // Hay una medición en curso
+thread_local unsigned long long asignacionesHilo = 0; // Sin atómicas: cada hilo la suya
+
+} // namespace
+
+void iniciarConteoAsignaciones() {
+    asignacionesHilo = 0;
+    contando.store(true, std::memory_order_relaxed);
+}
+
+unsigned long long detenerConteoAsignaciones() {
+    contando.store(false, std::memory_order_relaxed);
+    return asignacionesHilo;
+}
+
+// Reemplazos globales: las formas de arreglo y sin excepción delegan en estas
+void* operator new(std::size_t tam) {
+    if (contando.load(std::memory_order_relaxed)) {
+        ++asignacionesHilo;
+    }
+    if (void* p = std::malloc(tam ? tam : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
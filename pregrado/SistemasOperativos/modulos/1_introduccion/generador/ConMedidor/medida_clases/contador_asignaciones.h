@@ -0,0 +1,26 @@
+#ifndef CONTADOR_ASIGNACIONES_H
+#define CONTADOR_ASIGNACIONES_H
+
+/**
+ * Conteo de asignaciones dinámicas durante una medición.
+ *
+ * POR QUÉ: Medir si una consulta asigna memoria no se puede hacer con el RSS,
+ *          que casi no cambia con asignaciones pequeñas y liberadas enseguida.
+ * CÓMO: contador_asignaciones.cpp reemplaza el operator new global. Fuera de una
+ *       medición solo lee una bandera que nadie escribe (sin operaciones atómicas
+ *       de lectura-escritura ni línea de caché compartida en disputa); durante
+ *       una medición suma en un contador propio de cada hilo.
+ * PARA QUÉ: Benchmarks que reportan asignaciones por operación sin encarecer
+ *           las asignaciones del resto del programa.
+ *
+ * Solo se cuentan las asignaciones del hilo que inició la medición.
+ */
+
+// Empieza a contar las asignaciones del hilo que llama (desde cero)
+void iniciarConteoAsignaciones();
+
+// Deja de contar y devuelve las llamadas a operator new del hilo que llama
+// desde iniciarConteoAsignaciones()
+unsigned long long detenerConteoAsignaciones();
+
+#endif // CONTADOR_ASIGNACIONES_H
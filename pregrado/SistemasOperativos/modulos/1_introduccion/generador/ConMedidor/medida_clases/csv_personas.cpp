@@ -0,0 +1,312 @@
+#include "csv_personas.h"
+#include <algorithm>     // std::min
+#include <atomic>
+#include <charconv>      // std::to_chars, std::from_chars
+#include <cstring>       // std::memchr
+#include <exception>     // std::exception
+#include <fstream>
+#include <iomanip>       // std::setprecision
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <fcntl.h>       // open
+#include <sys/mman.h>    // mmap, munmap
+#include <sys/stat.h>    // fstat
+#include <unistd.h>      // write, close
+
+const char* const ENCABEZADO_CSV =
+    "id,nombre,apellido,ciudadNacimiento,fechaNacimiento,"
+    "ingresosAnuales,patrimonio,deudas,declaranteRenta\n";
+
+namespace {
+
+// Agrega un monto con 2 decimales usando std::to_chars
+void agregarMonto(std::string& bufer, double valor) {
+    char numero[64];
+    auto resultado = std::to_chars(numero, numero + sizeof(numero), valor,
+                                   std::chars_format::fixed, 2);
+    bufer.append(numero, resultado.ptr);
+}
+
+// Escribe todo el búfer con write(2), reintentando escrituras parciales
+bool escribirTodo(int fd, const std::string& bufer) {
+    const char* datos = bufer.data();
+    size_t restante = bufer.size();
+    while (restante > 0) {
+        ssize_t escritos = write(fd, datos, restante);
+        if (escritos <= 0) {
+            return false;
+        }
+        datos += escritos;
+        restante -= static_cast<size_t>(escritos);
+    }
+    return true;
+}
+
+/**
+ * Analiza una línea CSV y construye la persona.
+ *
+ * CÓMO: Separa los 9 campos con memchr sobre string_view (sin copiar),
+ *       convierte los números con std::from_chars e interna nombre, apellido y
+ *       ciudad con la caché del hilo (sin el cerrojo global para textos ya vistos).
+ * @return false si la línea no tiene el formato esperado.
+ */
+bool analizarLinea(std::string_view linea, Persona& persona, CacheCodigos& cache) {
+    std::string_view campos[9];
+    size_t inicio = 0;
+    for (int c = 0; c < 9; ++c) {
+        const char* coma = (c < 8)
+            ? static_cast<const char*>(std::memchr(linea.data() + inicio, ',', linea.size() - inicio))
+            : nullptr;
+        if (c < 8 && !coma) {
+            return false;
+        }
+        size_t fin = coma ? static_cast<size_t>(coma - linea.data()) : linea.size();
+        campos[c] = linea.substr(inicio, fin - inicio);
+        inicio = fin + 1;
+    }
+
+    double montos[3];
+    for (int m = 0; m < 3; ++m) {
+        std::string_view campo = campos[5 + m];
+        auto resultado = std::from_chars(campo.data(), campo.data() + campo.size(), montos[m]);
+        if (resultado.ec != std::errc() || resultado.ptr != campo.data() + campo.size()) {
+            return false;
+        }
+    }
+    if (campos[8] != "0" && campos[8] != "1") {
+        return false;
+    }
+    Fecha fecha = Fecha::desdeTexto(campos[4]);
+    if (!fecha.valida()) {
+        return false; // Sin esto quedaría la Fecha nula y se exportaría como 0/0/0
+    }
+
+    persona = Persona(cache.internar(campos[1]), cache.internar(campos[2]), std::string(campos[0]),
+                      cache.internar(campos[3]), fecha,
+                      montos[0], montos[1], montos[2], campos[8] == "1");
+    return true;
+}
+
+// Avanza hasta el inicio de la siguiente línea (o 'fin')
+const char* siguienteLinea(const char* p, const char* fin) {
+    const char* salto = static_cast<const char*>(std::memchr(p, '\n', fin - p));
+    return salto ? salto + 1 : fin;
+}
+
+// Línea [p, siguiente) sin el '\n' ni el '\r' finales (archivos con fin de línea de Windows)
+std::string_view contenidoLinea(const char* p, const char* siguiente) {
+    size_t largo = static_cast<size_t>(siguiente - p);
+    if (largo > 0 && p[largo - 1] == '\n') {
+        --largo;
+    }
+    if (largo > 0 && p[largo - 1] == '\r') {
+        --largo;
+    }
+    return std::string_view(p, largo);
+}
+
+} // namespace
+
+void agregarPersonaCSV(std::string& bufer, const Persona& p) {
+    bufer += p.getId();
+    bufer += ',';
+    bufer += p.getNombre();
+    bufer += ',';
+    bufer += p.getApellido();
+    bufer += ',';
+    bufer += p.getCiudadNacimiento();
+    bufer += ',';
+    char fecha[Fecha::LARGO_MAXIMO];
+    bufer.append(fecha, p.getFechaNacimiento().escribir(fecha));
+    bufer += ',';
+    agregarMonto(bufer, p.getIngresosAnuales());
+    bufer += ',';
+    agregarMonto(bufer, p.getPatrimonio());
+    bufer += ',';
+    agregarMonto(bufer, p.getDeudas());
+    bufer += p.getDeclaranteRenta() ? ",1\n" : ",0\n";
+}
+
+/**
+ * Implementación de exportarPersonasCSV.
+ *
+ * POR QUÉ: Exportar millones de filas sin que el formateo sea el cuello de botella.
+ * CÓMO: Búfer de 8 MB reutilizado; cuando se llena se vacía con write(2).
+ * PARA QUÉ: Pocas llamadas al sistema y ninguna asignación por registro.
+ */
+unsigned long long exportarPersonasCSV(const std::vector<Persona>& personas, const std::string& ruta) {
+    int fd = open(ruta.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::perror(("Error al abrir " + ruta).c_str());
+        return 0;
+    }
+
+    const size_t TAM_BUFER = 8 * 1024 * 1024;
+    std::string bufer;
+    bufer.reserve(TAM_BUFER + 4096);
+    bufer = ENCABEZADO_CSV;
+
+    unsigned long long total = 0;
+    bool ok = true;
+    for (const auto& p : personas) {
+        agregarPersonaCSV(bufer, p);
+        if (bufer.size() >= TAM_BUFER) {
+            ok = escribirTodo(fd, bufer);
+            total += bufer.size();
+            bufer.clear();
+            if (!ok) {
+                break;
+            }
+        }
+    }
+    if (ok && !bufer.empty()) {
+        ok = escribirTodo(fd, bufer);
+        total += bufer.size();
+    }
+    if (close(fd) != 0 || !ok) {
+        std::cerr << "Error al escribir " << ruta << "\n";
+        return 0;
+    }
+    return total;
+}
+
+unsigned long long exportarPersonasCSVFlujo(const std::vector<Persona>& personas, const std::string& ruta) {
+    std::ofstream archivo(ruta);
+    if (!archivo) {
+        std::cerr << "Error al abrir archivo: " << ruta << std::endl;
+        return 0;
+    }
+    archivo << ENCABEZADO_CSV << std::fixed << std::setprecision(2);
+    for (const auto& p : personas) {
+        archivo << p.getId() << "," << p.getNombre() << "," << p.getApellido() << ","
+                << p.getCiudadNacimiento() << "," << p.getFechaNacimiento() << ","
+                << p.getIngresosAnuales() << "," << p.getPatrimonio() << ","
+                << p.getDeudas() << "," << (p.getDeclaranteRenta() ? 1 : 0) << "\n";
+    }
+    unsigned long long total = static_cast<unsigned long long>(archivo.tellp());
+    archivo.close();
+    return archivo ? total : 0;
+}
+
+/**
+ * Implementación de importarPersonasCSV.
+ *
+ * POR QUÉ: Analizar un CSV grande en un solo hilo desaprovecha los núcleos.
+ * CÓMO: 1) mmap del archivo; 2) tramos por hilo ajustados a inicio de línea;
+ *       3) conteo de líneas no vacías por tramo (en paralelo) y sumas prefijas para saber
+ *       dónde escribe cada hilo; 4) análisis en paralelo sobre el vector pre-dimensionado.
+ * PARA QUÉ: Importar con el mismo orden del archivo y sin bloqueos entre hilos.
+ */
+bool importarPersonasCSV(const std::string& ruta, std::vector<Persona>& personas,
+                         unsigned hilos, unsigned long long& bytes) {
+    int fd = open(ruta.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::perror(("Error al abrir " + ruta).c_str());
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        std::cerr << "Archivo CSV vacío o inválido: " << ruta << "\n";
+        close(fd);
+        return false;
+    }
+    size_t tamano = static_cast<size_t>(info.st_size);
+    void* mapeo = mmap(nullptr, tamano, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapeo == MAP_FAILED) {
+        std::perror("Error en mmap");
+        return false;
+    }
+    madvise(mapeo, tamano, MADV_SEQUENTIAL);
+    bytes = tamano;
+
+    const char* inicio = static_cast<const char*>(mapeo);
+    const char* fin = inicio + tamano;
+    const char* datos = siguienteLinea(inicio, fin); // Salta el encabezado
+
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Tramos [cortes[t], cortes[t+1]) que empiezan siempre en inicio de línea
+    std::vector<const char*> cortes(hilos + 1);
+    size_t largoDatos = static_cast<size_t>(fin - datos);
+    cortes[0] = datos;
+    cortes[hilos] = fin;
+    for (unsigned t = 1; t < hilos; ++t) {
+        const char* aproximado = datos + largoDatos * t / hilos;
+        cortes[t] = std::max(cortes[t - 1],
+                             aproximado == datos ? datos : siguienteLinea(aproximado - 1, fin));
+    }
+
+    // Fase 1: contar líneas de cada tramo en paralelo
+    std::vector<size_t> lineas(hilos, 0);
+    auto contar = [&](unsigned t) {
+        size_t total = 0;
+        const char* p = cortes[t];
+        while (p < cortes[t + 1]) {
+            const char* siguiente = siguienteLinea(p, cortes[t + 1]);
+            total += !contenidoLinea(p, siguiente).empty(); // Las líneas vacías no son filas
+            p = siguiente;
+        }
+        lineas[t] = total;
+    };
+    std::vector<std::thread> grupo;
+    for (unsigned t = 1; t < hilos; ++t) {
+        grupo.emplace_back(contar, t);
+    }
+    contar(0);
+    for (auto& h : grupo) {
+        h.join();
+    }
+    grupo.clear();
+
+    // Sumas prefijas: primera fila de cada tramo
+    std::vector<size_t> primeraFila(hilos + 1, 0);
+    for (unsigned t = 0; t < hilos; ++t) {
+        primeraFila[t + 1] = primeraFila[t] + lineas[t];
+    }
+
+    // Fase 2: analizar cada tramo directamente en su posición final
+    std::vector<Persona> resultado(primeraFila[hilos]);
+    std::atomic<bool> ok(true);
+    auto analizar = [&](unsigned t) {
+        CacheCodigos cache; // Una por hilo: sin cerrojo para los textos ya vistos
+        size_t fila = primeraFila[t];
+        const char* p = cortes[t];
+        try {
+            while (p < cortes[t + 1] && ok.load(std::memory_order_relaxed)) {
+                const char* siguiente = siguienteLinea(p, cortes[t + 1]);
+                std::string_view linea = contenidoLinea(p, siguiente);
+                p = siguiente;
+                if (linea.empty()) {
+                    continue; // Salto final del archivo o línea en blanco: se omite como en el conteo
+                }
+                if (!analizarLinea(linea, resultado[fila], cache)) {
+                    ok = false;
+                    std::cerr << "Línea inválida en " << ruta << " (fila " << fila << ")\n";
+                }
+                ++fila;
+            }
+        } catch (const std::exception& e) {
+            // Diccionario lleno o sin memoria: la importación falla sin terminar el proceso
+            ok = false;
+            std::cerr << "Error al importar " << ruta << " (fila " << fila << "): " << e.what() << "\n";
+        }
+    };
+    for (unsigned t = 1; t < hilos; ++t) {
+        grupo.emplace_back(analizar, t);
+    }
+    analizar(0);
+    for (auto& h : grupo) {
+        h.join();
+    }
+
+    munmap(mapeo, tamano);
+    if (!ok) {
+        return false;
+    }
+    personas = std::move(resultado);
+    return true;
+}
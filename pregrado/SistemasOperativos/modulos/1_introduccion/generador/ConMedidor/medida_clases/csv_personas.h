@@ -0,0 +1,70 @@
+#ifndef CSV_PERSONAS_H
+#define CSV_PERSONAS_H
+
+#include "persona.h"
+#include <string>
+#include <vector>
+
+/**
+ * Importación y exportación de colecciones de personas en CSV.
+ *
+ * Formato: una línea de encabezado y luego una línea por persona:
+ *   id,nombre,apellido,ciudadNacimiento,fechaNacimiento,ingresosAnuales,patrimonio,deudas,declaranteRenta
+ * Los montos se escriben con 2 decimales y declaranteRenta como 0/1.
+ * Los vocabularios del generador no contienen comas ni comillas, por eso no se
+ * usan campos entre comillas.
+ */
+
+// Encabezado de los archivos CSV de personas
+extern const char* const ENCABEZADO_CSV;
+
+/**
+ * Agrega una persona como línea CSV al final de un búfer.
+ *
+ * POR QUÉ: operator<< con std::fixed/std::setprecision es lento (locale, estado del flujo).
+ * CÓMO: Los números se formatean con std::to_chars en un arreglo local y se
+ *       copian al búfer; no se crean strings temporales.
+ * PARA QUÉ: Compartir el formato entre el exportador y el sumidero CSV del flujo.
+ */
+void agregarPersonaCSV(std::string& bufer, const Persona& p);
+
+/**
+ * Exporta una colección a un archivo CSV.
+ *
+ * POR QUÉ: Intercambiar conjuntos de datos con otras herramientas.
+ * CÓMO: Llena un búfer grande (8 MB) con agregarPersonaCSV y lo escribe con
+ *       write(2) cada vez que se llena.
+ * PARA QUÉ: Exportar a velocidad cercana a la del disco.
+ *
+ * @return Bytes escritos, o 0 si hubo un error.
+ */
+unsigned long long exportarPersonasCSV(const std::vector<Persona>& personas, const std::string& ruta);
+
+/**
+ * Versión de referencia con std::ofstream, operator<<, std::fixed y std::setprecision.
+ *
+ * PARA QUÉ: Comparar en el benchmark contra exportarPersonasCSV.
+ * @return Bytes escritos, o 0 si hubo un error.
+ */
+unsigned long long exportarPersonasCSVFlujo(const std::vector<Persona>& personas, const std::string& ruta);
+
+/**
+ * Importa un archivo CSV de personas usando varios hilos.
+ *
+ * POR QUÉ: Leer CSV con getline/stringstream crea varios strings temporales por línea.
+ * CÓMO: Proyecta el archivo con mmap, lo parte en 'hilos' tramos ajustados a
+ *       inicios de línea, cuenta las líneas de cada tramo, pre-dimensiona el
+ *       vector y cada hilo analiza su tramo con string_view y std::from_chars,
+ *       interna los textos con su propia CacheCodigos (sin cerrojo para los ya vistos),
+ *       escribiendo cada persona en su posición final.
+ * PARA QUÉ: Importación paralela con el mismo orden de filas que el archivo.
+ *
+ * @param hilos Número de hilos (0 = todos los núcleos).
+ * @param bytes Salida: tamaño del archivo leído.
+ * @return false si el archivo no existe, alguna línea es inválida o el
+ *         Diccionario global se llenó (el error se informa, no termina el proceso).
+ */
+bool importarPersonasCSV(const std::string& ruta, std::vector<Persona>& personas,
+                         unsigned hilos, unsigned long long& bytes);
+
+#endif // CSV_PERSONAS_H
@@ -0,0 +1,69 @@
+#include "diccionario.h"
+#include <mutex>     // std::unique_lock
+#include <stdexcept> // std::length_error
+
+Diccionario& Diccionario::global() {
+    static Diccionario instancia; // Inicialización segura entre hilos (C++11)
+    return instancia;
+}
+
+Diccionario::Diccionario() : total(0) {
+    internar(""); // El código 0 es el string vacío (Persona por defecto)
+}
+
+/**
+ * Implementación de internar.
+ *
+ * POR QUÉ: Garantizar un único código por texto aunque varios hilos internen a la vez.
+ * CÓMO: Primero una búsqueda con cerrojo compartido (el caso común: el texto
+ *       ya existe); si falla, se vuelve a buscar bajo cerrojo exclusivo antes
+ *       de insertar. La clave del mapa es un string_view que apunta al texto ya
+ *       copiado en su bloque definitivo.
+ * PARA QUÉ: Que los códigos sean estables y comparables entre sí.
+ */
+uint32_t Diccionario::internar(std::string_view texto) {
+    {
+        std::shared_lock<std::shared_mutex> lectura(cerrojo);
+        auto it = codigos.find(texto);
+        if (it != codigos.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> escritura(cerrojo);
+    auto it = codigos.find(texto); // Otro hilo pudo agregarlo entre ambos cerrojos
+    if (it != codigos.end()) {
+        return it->second;
+    }
+
+    uint32_t codigo = total.load(std::memory_order_relaxed);
+    uint32_t bloque = codigo / TAM_BLOQUE;
+    if (bloque >= MAX_BLOQUES) {
+        throw std::length_error("Diccionario lleno: demasiados textos distintos");
+    }
+    if (!bloques[bloque]) {
+        bloques[bloque].reset(new std::string[TAM_BLOQUE]);
+    }
+    std::string& destino = bloques[bloque][codigo % TAM_BLOQUE];
+    destino.assign(texto.data(), texto.size());
+    codigos.emplace(std::string_view(destino), codigo);
+
+    total.store(codigo + 1, std::memory_order_release); // Publica el nuevo texto
+    return codigo;
+}
+
+size_t Diccionario::memoria_bytes() const {
+    std::shared_lock<std::shared_mutex> lectura(cerrojo);
+    size_t bytes = 0;
+    for (const auto& bloque : bloques) {
+        if (bloque) {
+            bytes += TAM_BLOQUE * sizeof(std::string);
+        }
+    }
+    for (uint32_t c = 0; c < total.load(std::memory_order_relaxed); ++c) {
+        if (texto(c).capacity() > 15) { // Fuera del búfer interno (SSO) de std::string
+            bytes += texto(c).capacity() + 1;
+        }
+    }
+    return bytes + codigos.size() * (sizeof(std::string_view) + sizeof(uint32_t) + 2 * sizeof(void*));
+}
@@ -0,0 +1,91 @@
+#ifndef DICCIONARIO_H
+#define DICCIONARIO_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * Diccionario global de strings internados.
+ *
+ * POR QUÉ: nombre, apellido y ciudad toman uno de unos pocos cientos de valores,
+ *          pero cada Persona guardaba su propia copia en un std::string.
+ * CÓMO: Cada texto distinto se guarda una sola vez y se identifica con un código
+ *       de 32 bits. Los textos viven en bloques de tamaño fijo que nunca se mueven,
+ *       así que leer un código no necesita bloqueo; buscar un texto existente
+ *       toma el cerrojo compartido y solo agregar uno nuevo lo toma en exclusiva.
+ * PARA QUÉ: Personas más pequeñas y generación sin asignaciones para esos campos.
+ *
+ * El código 0 es siempre el string vacío.
+ */
+class Diccionario {
+public:
+    static Diccionario& global();
+
+    /**
+     * Devuelve el código de un texto, agregándolo si no existe.
+     *
+     * CÓMO: Búsqueda en la tabla hash con cerrojo compartido; si no está, se
+     *       repite bajo cerrojo exclusivo, se copia al siguiente espacio libre
+     *       y se publica su código.
+     * Seguro para varios hilos a la vez.
+     */
+    uint32_t internar(std::string_view texto);
+
+    /**
+     * Texto asociado a un código (sin bloqueo).
+     *
+     * El código debe venir de internar(); la referencia es válida mientras dure el programa.
+     */
+    const std::string& texto(uint32_t codigo) const {
+        return bloques[codigo / TAM_BLOQUE][codigo % TAM_BLOQUE];
+    }
+
+    size_t size() const { return total.load(std::memory_order_acquire); }
+    size_t memoria_bytes() const;
+
+private:
+    static const uint32_t TAM_BLOQUE = 4096;       // Textos por bloque
+    static const uint32_t MAX_BLOQUES = 1024;      // Capacidad: ~4 millones de textos
+
+    Diccionario();
+
+    std::array<std::unique_ptr<std::string[]>, MAX_BLOQUES> bloques; // Nunca se reubican
+    std::atomic<uint32_t> total;                                     // Textos internados
+    std::unordered_map<std::string_view, uint32_t> codigos;          // Texto -> código
+    mutable std::shared_mutex cerrojo;                               // Protege 'codigos' y altas
+};
+
+/**
+ * Caché local de códigos del Diccionario global, para usar desde un solo hilo.
+ *
+ * POR QUÉ: Diccionario::internar() toma el cerrojo compartido en cada llamada;
+ *          con varios hilos internando millones de filas todos compiten por él.
+ * CÓMO: Un mapa propio texto -> código sin bloqueo; solo los textos que este hilo
+ *       ve por primera vez pasan por el diccionario global. Las claves apuntan al
+ *       texto guardado en el diccionario, que nunca se mueve.
+ * PARA QUÉ: Tocar el cerrojo global una vez por texto distinto y por hilo.
+ */
+class CacheCodigos {
+public:
+    uint32_t internar(std::string_view texto) {
+        auto it = codigos.find(texto);
+        if (it != codigos.end()) {
+            return it->second;
+        }
+        Diccionario& dic = Diccionario::global();
+        uint32_t codigo = dic.internar(texto); // Puede lanzar std::length_error
+        codigos.emplace(std::string_view(dic.texto(codigo)), codigo);
+        return codigo;
+    }
+
+private:
+    std::unordered_map<std::string_view, uint32_t> codigos;
+};
+
+#endif // DICCIONARIO_H
@@ -0,0 +1,81 @@
+#include "fecha.h"
+#include <charconv> // std::from_chars
+#include <ctime>    // std::time, localtime_r
+#include <ostream>
+
+namespace {
+
+// Escribe 'valor' (0-9999) en decimal sin ceros a la izquierda
+char* escribirNumero(char* destino, int valor) {
+    char digitos[4];
+    int n = 0;
+    do {
+        digitos[n++] = static_cast<char>('0' + valor % 10);
+        valor /= 10;
+    } while (valor > 0 && n < 4);
+    while (n > 0) {
+        *destino++ = digitos[--n];
+    }
+    return destino;
+}
+
+} // namespace
+
+/**
+ * Implementación de Fecha::desdeTexto.
+ *
+ * POR QUÉ: El CSV y el struct de medida_estructura guardan la fecha como texto.
+ * CÓMO: Tres std::from_chars separados por '/', con validación de rangos.
+ * PARA QUÉ: Importar fechas sin crear substrings.
+ */
+Fecha Fecha::desdeTexto(std::string_view texto) {
+    int partes[3];
+    const char* p = texto.data();
+    const char* fin = texto.data() + texto.size();
+    for (int i = 0; i < 3; ++i) {
+        auto resultado = std::from_chars(p, fin, partes[i]);
+        if (resultado.ec != std::errc() || (i < 2 && (resultado.ptr == fin || *resultado.ptr != '/'))) {
+            return Fecha();
+        }
+        p = resultado.ptr + (i < 2 ? 1 : 0);
+    }
+    int dia = partes[0], mes = partes[1], anio = partes[2];
+    if (p != fin || dia < 1 || dia > 31 || mes < 1 || mes > 12 || anio < 1 || anio > 9999) {
+        return Fecha();
+    }
+    return Fecha(anio, mes, dia);
+}
+
+Fecha Fecha::hoy() {
+    std::time_t ahora = std::time(nullptr);
+    std::tm local;
+    localtime_r(&ahora, &local);
+    return Fecha(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
+}
+
+size_t Fecha::escribir(char* destino) const {
+    char* p = escribirNumero(destino, dia());
+    *p++ = '/';
+    p = escribirNumero(p, mes());
+    *p++ = '/';
+    p = escribirNumero(p, anio());
+    return static_cast<size_t>(p - destino);
+}
+
+std::string Fecha::texto() const {
+    char bufer[LARGO_MAXIMO];
+    return std::string(bufer, escribir(bufer));
+}
+
+std::ostream& operator<<(std::ostream& salida, Fecha fecha) {
+    char bufer[Fecha::LARGO_MAXIMO];
+    return salida.write(bufer, static_cast<std::streamsize>(fecha.escribir(bufer)));
+}
+
+RangoFechas RangoFechas::porEdad(int edadMinima, int edadMaxima, Fecha referencia) {
+    RangoFechas r;
+    r.hasta = Fecha(referencia.anio() - edadMinima, referencia.mes(), referencia.dia());
+    Fecha limiteExclusivo(referencia.anio() - edadMaxima - 1, referencia.mes(), referencia.dia());
+    r.desde = Fecha::desdeCodigo(limiteExclusivo.getCodigo() + 1);
+    return r;
+}
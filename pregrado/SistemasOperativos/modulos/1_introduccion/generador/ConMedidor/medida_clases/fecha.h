@@ -0,0 +1,97 @@
+#ifndef FECHA_H
+#define FECHA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+/**
+ * Fecha del calendario empaquetada en un entero de 32 bits.
+ *
+ * POR QUÉ: Guardar la fecha de nacimiento como texto "D/M/AAAA" costaba tres
+ *          std::to_string y dos concatenaciones por persona, y toda consulta por
+ *          edad tenía que volver a leer el texto de cada registro.
+ * CÓMO: codigo = (año << 9) | (mes << 5) | día. El año ocupa los bits altos y el
+ *       día los bajos, así que el orden de los enteros es el orden de las fechas.
+ * PARA QUÉ: Filtros por edad o por rango de nacimiento como comparaciones de
+ *           enteros; el texto se arma solo para mostrar o exportar.
+ */
+class Fecha {
+public:
+    static const size_t LARGO_MAXIMO = 10; // "DD/MM/AAAA"
+
+    Fecha() : codigo(0) {} // Fecha nula: no corresponde a ningún día
+    Fecha(int anio, int mes, int dia)
+        : codigo((static_cast<uint32_t>(anio) << 9) | (static_cast<uint32_t>(mes) << 5)
+                 | static_cast<uint32_t>(dia)) {}
+
+    static Fecha desdeCodigo(uint32_t codigo) { Fecha f; f.codigo = codigo; return f; }
+
+    /**
+     * Lee una fecha "D/M/AAAA" (día y mes con uno o dos dígitos).
+     * @return La fecha, o la fecha nula si el texto no tiene ese formato.
+     */
+    static Fecha desdeTexto(std::string_view texto);
+
+    static Fecha hoy(); // Fecha local del sistema
+
+    int anio() const { return static_cast<int>(codigo >> 9); }
+    int mes() const { return static_cast<int>((codigo >> 5) & 0xF); }
+    int dia() const { return static_cast<int>(codigo & 0x1F); }
+    uint32_t getCodigo() const { return codigo; }
+    bool valida() const { return codigo != 0; }
+
+    // Años cumplidos en la fecha 'referencia'
+    int edadEn(Fecha referencia) const {
+        int edad = referencia.anio() - anio();
+        return (referencia.codigo & 0x1FF) < (codigo & 0x1FF) ? edad - 1 : edad;
+    }
+
+    /**
+     * Escribe la fecha como "D/M/AAAA" en 'destino' (al menos LARGO_MAXIMO bytes, sin '\0').
+     * @return Bytes escritos.
+     */
+    size_t escribir(char* destino) const;
+    std::string texto() const;
+
+    bool operator==(Fecha otra) const { return codigo == otra.codigo; }
+    bool operator!=(Fecha otra) const { return codigo != otra.codigo; }
+    bool operator<(Fecha otra) const { return codigo < otra.codigo; }
+    bool operator<=(Fecha otra) const { return codigo <= otra.codigo; }
+    bool operator>(Fecha otra) const { return codigo > otra.codigo; }
+    bool operator>=(Fecha otra) const { return codigo >= otra.codigo; }
+
+private:
+    uint32_t codigo;
+};
+
+std::ostream& operator<<(std::ostream& salida, Fecha fecha);
+
+/**
+ * Intervalo cerrado de fechas [desde, hasta].
+ *
+ * POR QUÉ: Un filtro por edad es un filtro por fecha de nacimiento con los
+ *          límites calculados una sola vez.
+ * CÓMO: Dos comparaciones de enteros por registro.
+ * PARA QUÉ: Consultas por edad o por rango de nacimiento sin leer texto.
+ */
+struct RangoFechas {
+    Fecha desde;
+    Fecha hasta;
+
+    bool contiene(Fecha f) const { return desde <= f && f <= hasta; }
+
+    /**
+     * Nacidos con edad entre 'edadMinima' y 'edadMaxima' años cumplidos en 'referencia'.
+     *
+     * CÓMO: edad >= a  <=>  nacimiento <= referencia - a años;
+     *       edad <= b  <=>  nacimiento >  referencia - (b + 1) años.
+     *       El límite inferior exclusivo se vuelve inclusivo sumando 1 al código:
+     *       puede no ser un día real, pero el orden de los códigos se conserva.
+     */
+    static RangoFechas porEdad(int edadMinima, int edadMaxima, Fecha referencia);
+};
+
+#endif // FECHA_H
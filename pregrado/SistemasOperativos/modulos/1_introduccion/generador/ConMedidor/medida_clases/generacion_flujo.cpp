@@ -0,0 +1,158 @@
+#include "generacion_flujo.h"
+#include "generador.h"
+#include "csv_personas.h"
+#include <algorithm> // std::min
+#include <cstring>   // std::memcpy
+#include <future>    // std::async, std::future
+
+namespace {
+
+// Añade un string con prefijo de longitud de 1 byte (los campos son cortos)
+void agregarTexto(std::string& bufer, const std::string& texto) {
+    unsigned char largo = static_cast<unsigned char>(texto.size() < 255 ? texto.size() : 255);
+    bufer.push_back(static_cast<char>(largo));
+    bufer.append(texto, 0, largo);
+}
+
+// Añade el código de una fecha en 4 bytes crudos
+void agregarFecha(std::string& bufer, Fecha fecha) {
+    uint32_t codigo = fecha.getCodigo();
+    char bytes[sizeof(uint32_t)];
+    std::memcpy(bytes, &codigo, sizeof(uint32_t));
+    bufer.append(bytes, sizeof(uint32_t));
+}
+
+// Añade los bytes crudos de un double
+void agregarDouble(std::string& bufer, double valor) {
+    char bytes[sizeof(double)];
+    std::memcpy(bytes, &valor, sizeof(double));
+    bufer.append(bytes, sizeof(double));
+}
+
+// Serializa una persona en formato binario
+void serializarBinario(std::string& bufer, const Persona& p) {
+    agregarTexto(bufer, p.getNombre());
+    agregarTexto(bufer, p.getApellido());
+    agregarTexto(bufer, p.getId());
+    agregarTexto(bufer, p.getCiudadNacimiento());
+    agregarFecha(bufer, p.getFechaNacimiento());
+    agregarDouble(bufer, p.getIngresosAnuales());
+    agregarDouble(bufer, p.getPatrimonio());
+    agregarDouble(bufer, p.getDeudas());
+    bufer.push_back(p.getDeclaranteRenta() ? 1 : 0);
+}
+
+// Bytes que ocupa una persona en formato binario (sin serializarla)
+size_t tamanoBinario(const Persona& p) {
+    return 4 + p.getNombre().size() + p.getApellido().size() + p.getId().size()
+             + p.getCiudadNacimiento().size() + sizeof(uint32_t) + 3 * sizeof(double) + 1;
+}
+
+} // namespace
+
+bool SumideroNulo::escribir(const std::vector<Persona>& bloque) {
+    for (const auto& p : bloque) {
+        bytes += tamanoBinario(p);
+    }
+    return true;
+}
+
+SumideroArchivo::SumideroArchivo(const std::string& ruta, Formato formato)
+    : formato(formato), ruta(ruta) {
+    archivo = std::fopen(ruta.c_str(), "wb");
+    if (!archivo) {
+        std::perror(("Error al abrir " + ruta).c_str());
+        return;
+    }
+    // Cabecera del archivo
+    if (formato == Formato::Binario) {
+        bufer = "PERSFLU2"; // 2: fecha como código de 4 bytes
+    } else {
+        bufer = ENCABEZADO_CSV;
+    }
+    bytes += std::fwrite(bufer.data(), 1, bufer.size(), archivo);
+}
+
+SumideroArchivo::~SumideroArchivo() {
+    if (archivo) {
+        std::fclose(archivo);
+    }
+}
+
+std::string SumideroArchivo::nombre() const {
+    return (formato == Formato::Binario ? "binario " : "CSV ") + ruta;
+}
+
+/**
+ * Implementación de SumideroArchivo::escribir.
+ *
+ * POR QUÉ: Muchas escrituras pequeñas son lentas.
+ * CÓMO: Serializa todo el bloque en el búfer y hace un único fwrite.
+ * PARA QUÉ: Que la E/S se haga en trozos grandes.
+ */
+bool SumideroArchivo::escribir(const std::vector<Persona>& bloque) {
+    if (!archivo) {
+        return false;
+    }
+    bufer.clear(); // Conserva la capacidad reservada
+    for (const auto& p : bloque) {
+        if (formato == Formato::Binario) {
+            serializarBinario(bufer, p);
+        } else {
+            agregarPersonaCSV(bufer, p); // Mismo formato que exportarPersonasCSV
+        }
+    }
+    size_t escritos = std::fwrite(bufer.data(), 1, bufer.size(), archivo);
+    bytes += escritos;
+    return escritos == bufer.size();
+}
+
+/**
+ * Implementación de generarColeccionFlujo.
+ *
+ * POR QUÉ: Mantener la memoria constante y aprovechar el tiempo de E/S.
+ * CÓMO: Alterna dos búferes; el bloque k se escribe en un hilo (std::async)
+ *       mientras se genera el bloque k+1, y antes de reutilizar un búfer se
+ *       espera a que termine su escritura.
+ * PARA QUÉ: Generar conjuntos de cualquier tamaño directamente a disco.
+ */
+ResultadoFlujo generarColeccionFlujo(unsigned long long n, uint64_t semilla,
+                                     size_t tamBloque, Sumidero& sumidero) {
+    ResultadoFlujo resultado;
+    if (tamBloque == 0) {
+        tamBloque = 1;
+    }
+
+    std::vector<Persona> buferes[2];
+    std::future<bool> escritura; // Escritura en curso (si la hay)
+    int actual = 0;
+
+    for (unsigned long long inicio = 0; inicio < n; inicio += tamBloque) {
+        unsigned long long fin = std::min<unsigned long long>(inicio + tamBloque, n);
+
+        // Generar el bloque en el búfer libre
+        std::vector<Persona>& bloque = buferes[actual];
+        bloque.resize(fin - inicio);
+        for (unsigned long long i = inicio; i < fin; ++i) {
+            MotorAleatorio motor(semillaRegistro(semilla, i));
+            bloque[i - inicio] = generarPersona(motor, ID_INICIAL + static_cast<long>(i));
+        }
+
+        // Esperar la escritura del bloque anterior antes de lanzar la siguiente
+        if (escritura.valid() && !escritura.get()) {
+            resultado.ok = false;
+            break;
+        }
+        escritura = std::async(std::launch::async, [&sumidero, &bloque]() {
+            return sumidero.escribir(bloque);
+        });
+        resultado.registros += bloque.size();
+        actual = 1 - actual; // El próximo bloque usa el otro búfer
+    }
+
+    if (escritura.valid() && !escritura.get()) {
+        resultado.ok = false;
+    }
+    resultado.bytes = sumidero.bytes_escritos();
+    return resultado;
+}
@@ -0,0 +1,103 @@
+#ifndef GENERACION_FLUJO_H
+#define GENERACION_FLUJO_H
+
+#include "persona.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * Destino de los bloques producidos por la generación en flujo.
+ *
+ * POR QUÉ: La generación no debe saber si los datos van a disco, a CSV o a ninguna parte.
+ * CÓMO: Interfaz abstracta con un método para escribir un bloque completo.
+ * PARA QUÉ: Cambiar el destino sin tocar el generador y medir cada uno por separado.
+ */
+class Sumidero {
+public:
+    virtual ~Sumidero() {}
+
+    /**
+     * Escribe un bloque de personas.
+     * @return false si ocurrió un error de escritura.
+     */
+    virtual bool escribir(const std::vector<Persona>& bloque) = 0;
+
+    // Total de bytes producidos hasta ahora
+    virtual unsigned long long bytes_escritos() const = 0;
+
+    // Nombre del sumidero para reportes
+    virtual std::string nombre() const = 0;
+};
+
+/**
+ * Sumidero nulo: descarta los datos.
+ *
+ * PARA QUÉ: Medir la velocidad pura de generación, sin E/S.
+ */
+class SumideroNulo : public Sumidero {
+public:
+    bool escribir(const std::vector<Persona>& bloque) override;
+    unsigned long long bytes_escritos() const override { return bytes; }
+    std::string nombre() const override { return "nulo"; }
+
+private:
+    unsigned long long bytes = 0; // Bytes que ocuparían los registros en formato binario
+};
+
+/**
+ * Sumidero a archivo (binario o CSV).
+ *
+ * POR QUÉ: Persistir colecciones más grandes que la RAM.
+ * CÓMO: Serializa cada bloque en un búfer reutilizable y lo envía con una
+ *       sola llamada a fwrite por bloque.
+ *       - Binario: cabecera "PERSFLU2" y luego, por registro, cada string con
+ *         longitud de 1 byte, el código de la fecha en 4 bytes, los tres double
+ *         en crudo y el bool en 1 byte.
+ *       - CSV: mismo formato que exportarPersonasCSV (csv_personas.h).
+ * PARA QUÉ: Intercambiar datos y comparar la velocidad de ambos formatos.
+ */
+class SumideroArchivo : public Sumidero {
+public:
+    enum class Formato { Binario, CSV };
+
+    SumideroArchivo(const std::string& ruta, Formato formato);
+    ~SumideroArchivo() override;
+
+    bool abierto() const { return archivo != nullptr; }
+    bool escribir(const std::vector<Persona>& bloque) override;
+    unsigned long long bytes_escritos() const override { return bytes; }
+    std::string nombre() const override;
+
+private:
+    FILE* archivo = nullptr;
+    Formato formato;
+    std::string ruta;
+    std::string bufer;            // Búfer de serialización reutilizado entre bloques
+    unsigned long long bytes = 0;
+};
+
+/**
+ * Resultado de una generación en flujo.
+ */
+struct ResultadoFlujo {
+    unsigned long long registros = 0; // Registros generados y escritos
+    unsigned long long bytes = 0;     // Bytes entregados al sumidero
+    bool ok = true;                   // false si el sumidero falló
+};
+
+/**
+ * Genera n personas por bloques y las entrega a un sumidero.
+ *
+ * POR QUÉ: Generar todo en un std::vector limita el tamaño del conjunto a la RAM.
+ * CÓMO: Dos búferes de tamBloque personas: mientras un hilo escribe el bloque
+ *       anterior, el hilo principal genera el siguiente (doble búfer). Cada
+ *       registro i usa semillaRegistro(semilla, i) y cédula ID_INICIAL + i.
+ * PARA QUÉ: Memoria constante sin importar n, y generación solapada con la E/S.
+ *           Los registros son idénticos a los de generarColeccionParalela.
+ */
+ResultadoFlujo generarColeccionFlujo(unsigned long long n, uint64_t semilla,
+                                     size_t tamBloque, Sumidero& sumidero);
+
+#endif // GENERACION_FLUJO_H
@@ -1,9 +1,12 @@
 #include "generador.h"
+#include "persona_ref.h"
 #include <cstdlib>   // rand(), srand()
 #include <ctime>     // time()
 #include <random>    // std::mt19937, std::uniform_real_distribution
 #include <vector>
-#include <algorithm> // std::find_if
+#include <algorithm> // std::min, std::max
+#include <atomic>    // std::atomic (reparto de bloques entre hilos)
+#include <thread>    // std::thread
 
 // Bases de datos para generación realista
 
@@ -32,18 +35,61 @@ const std::vector<std::string> ciudadesColombia = {
     "Manizales", "Pasto", "Neiva", "Villavicencio", "Armenia", "Sincelejo", "Valledupar", "Montería", "Popayán", "Tunja"
 };
 
+namespace {
+
+/**
+ * Códigos del Diccionario para los vocabularios del generador.
+ * 
+ * POR QUÉ: Internar el texto de cada registro costaría un hash por campo.
+ * CÓMO: Se internan una sola vez todos los nombres, las ciudades y las
+ *       combinaciones de dos apellidos (apellidos.size()^2, índice a*N + b).
+ * PARA QUÉ: Que generar una persona solo copie enteros para esos campos.
+ */
+struct VocabularioInternado {
+    std::vector<uint32_t> femeninos;
+    std::vector<uint32_t> masculinos;
+    std::vector<uint32_t> apellidosCompuestos;
+    std::vector<uint32_t> ciudades;
+
+    VocabularioInternado() {
+        Diccionario& dic = Diccionario::global();
+        for (const auto& nombre : nombresFemeninos) {
+            femeninos.push_back(dic.internar(nombre));
+        }
+        for (const auto& nombre : nombresMasculinos) {
+            masculinos.push_back(dic.internar(nombre));
+        }
+        for (const auto& primero : apellidos) {
+            for (const auto& segundo : apellidos) {
+                apellidosCompuestos.push_back(dic.internar(primero + " " + segundo));
+            }
+        }
+        for (const auto& ciudad : ciudadesColombia) {
+            ciudades.push_back(dic.internar(ciudad));
+        }
+    }
+};
+
+// Tablas construidas en el primer uso (inicialización segura entre hilos)
+const VocabularioInternado& vocabulario() {
+    static const VocabularioInternado tablas;
+    return tablas;
+}
+
+} // namespace
+
 /**
  * Implementación de generarFechaNacimiento.
  * 
  * POR QUÉ: Simular fechas de nacimiento realistas.
- * CÓMO: Día (1-28), mes (1-12), año (1960-2009).
+ * CÓMO: Día (1-28), mes (1-12), año (1960-2009) empaquetados en un entero.
  * PARA QUÉ: Atributo fechaNacimiento de Persona.
  */
-std::string generarFechaNacimiento() {
+Fecha generarFechaNacimiento() {
     int dia = 1 + rand() % 28;       // Día: 1 a 28 (evita problemas con meses)
     int mes = 1 + rand() % 12;        // Mes: 1 a 12
     int anio = 1960 + rand() % 50;    // Año: 1960 a 2009
-    return std::to_string(dia) + "/" + std::to_string(mes) + "/" + std::to_string(anio);
+    return Fecha(anio, mes, dia);
 }
 
 /**
@@ -54,7 +100,7 @@ std::string generarFechaNacimiento() {
  * PARA QUÉ: Simular números de cédula.
  */
 std::string generarID() {
-    static long contador = 1000000000; // Inicia en 1,000,000,000
+    static long contador = ID_INICIAL; // Inicia en 1,000,000,000
     return std::to_string(contador++); // Convierte a string e incrementa
 }
 
@@ -79,23 +125,25 @@ double randomDouble(double min, double max) {
  * PARA QUÉ: Generar datos de prueba.
  */
 Persona generarPersona() {
+    const VocabularioInternado& voc = vocabulario();
+    
     // Decide si es hombre o mujer
     bool esHombre = rand() % 2;
     
     // Selecciona nombre según género
-    std::string nombre = esHombre ? 
-        nombresMasculinos[rand() % nombresMasculinos.size()] :
-        nombresFemeninos[rand() % nombresFemeninos.size()];
+    uint32_t nombre = esHombre ? 
+        voc.masculinos[rand() % voc.masculinos.size()] :
+        voc.femeninos[rand() % voc.femeninos.size()];
     
-    // Construye apellido compuesto (dos apellidos aleatorios)
-    std::string apellido = apellidos[rand() % apellidos.size()];
-    apellido += " ";
-    apellido += apellidos[rand() % apellidos.size()];
+    // Apellido compuesto (dos apellidos aleatorios, ya internado como par)
+    size_t primero = rand() % apellidos.size();
+    size_t segundo = rand() % apellidos.size();
+    uint32_t apellido = voc.apellidosCompuestos[primero * apellidos.size() + segundo];
     
     // Genera los demás atributos
     std::string id = generarID();
-    std::string ciudad = ciudadesColombia[rand() % ciudadesColombia.size()];
-    std::string fecha = generarFechaNacimiento();
+    uint32_t ciudad = voc.ciudades[rand() % voc.ciudades.size()];
+    Fecha fecha = generarFechaNacimiento();
     
     // Genera datos financieros realistas
     double ingresos = randomDouble(10000000, 500000000);   // 10M a 500M COP
@@ -103,7 +151,71 @@ Persona generarPersona() {
     double deudas = randomDouble(0, patrimonio * 0.7);     // Deudas hasta el 70% del patrimonio
     bool declarante = (ingresos > 50000000) && (rand() % 100 > 30); // Probabilidad 70% si ingresos > 50M
     
-    return Persona(nombre, apellido, id, ciudad, fecha, ingresos, patrimonio, deudas, declarante);
+    return Persona(nombre, apellido, std::move(id), ciudad, fecha,
+                   ingresos, patrimonio, deudas, declarante);
+}
+
+/**
+ * Implementación de semillaRegistro.
+ * 
+ * POR QUÉ: Derivar semillas independientes para registros consecutivos.
+ * CÓMO: Combina semilla e índice y aplica la mezcla final de SplitMix64.
+ * PARA QUÉ: Que registros vecinos no compartan secuencias aleatorias.
+ */
+uint64_t semillaRegistro(uint64_t semilla, uint64_t i) {
+    MotorAleatorio mezclador(semilla ^ (i * 0xD1B54A32D192ED03ULL));
+    return mezclador.siguiente();
+}
+
+/**
+ * Implementación de generarFechaNacimiento con motor propio.
+ * 
+ * POR QUÉ: Evitar rand() (estado global) en la generación paralela.
+ * CÓMO: Día (1-28), mes (1-12), año (1960-2009) tomados del motor.
+ * PARA QUÉ: Atributo fechaNacimiento de Persona.
+ */
+Fecha generarFechaNacimiento(MotorAleatorio& motor) {
+    int dia = 1 + motor.entero(28);
+    int mes = 1 + motor.entero(12);
+    int anio = 1960 + motor.entero(50);
+    return Fecha(anio, mes, dia);
+}
+
+/**
+ * Implementación de generarPersona con motor propio.
+ * 
+ * POR QUÉ: Crear una persona sin tocar estado global.
+ * CÓMO: Misma lógica de campos que generarPersona(), con números del motor.
+ * PARA QUÉ: Generación paralela y reproducible.
+ */
+Persona generarPersona(MotorAleatorio& motor, long numeroId) {
+    const VocabularioInternado& voc = vocabulario();
+    
+    // Decide si es hombre o mujer
+    bool esHombre = motor.entero(2);
+    
+    // Selecciona nombre según género
+    uint32_t nombre = esHombre ?
+        voc.masculinos[motor.entero(voc.masculinos.size())] :
+        voc.femeninos[motor.entero(voc.femeninos.size())];
+    
+    // Apellido compuesto (dos apellidos aleatorios, ya internado como par)
+    uint32_t primero = motor.entero(apellidos.size());
+    uint32_t segundo = motor.entero(apellidos.size());
+    uint32_t apellido = voc.apellidosCompuestos[primero * apellidos.size() + segundo];
+    
+    // Genera los demás atributos
+    uint32_t ciudad = voc.ciudades[motor.entero(voc.ciudades.size())];
+    Fecha fecha = generarFechaNacimiento(motor);
+    
+    // Genera datos financieros realistas (mismos rangos que generarPersona())
+    double ingresos = motor.real(10000000, 500000000);
+    double patrimonio = motor.real(0, 2000000000);
+    double deudas = motor.real(0, patrimonio * 0.7);
+    bool declarante = (ingresos > 50000000) && (motor.entero(100) > 30);
+    
+    return Persona(nombre, apellido, std::to_string(numeroId), ciudad,
+                   fecha, ingresos, patrimonio, deudas, declarante);
 }
 
 /**
@@ -124,21 +236,93 @@ std::vector<Persona> generarColeccion(int n) {
     return personas;
 }
 
+/**
+ * Implementación de generarColeccionParalela.
+ * 
+ * POR QUÉ: Usar todos los núcleos para generar colecciones grandes.
+ * CÓMO: Es agregar n personas a una colección vacía.
+ * PARA QUÉ: Generación escalable y determinista.
+ */
+std::vector<Persona> generarColeccionParalela(int n, uint64_t semilla, unsigned hilos) {
+    std::vector<Persona> personas;
+    agregarPersonasParalelo(personas, n > 0 ? static_cast<size_t>(n) : 0, semilla, ID_INICIAL, hilos);
+    return personas;
+}
+
+/**
+ * Implementación de agregarPersonasParalelo.
+ * 
+ * POR QUÉ: Generar en paralelo solo las filas nuevas.
+ * CÓMO: Los hilos toman bloques de BLOQUE registros de un contador atómico
+ *       (reparto dinámico) y escriben cada persona en su posición del vector.
+ * PARA QUÉ: Crecimiento escalable y determinista.
+ */
+void agregarPersonasParalelo(std::vector<Persona>& personas, size_t n, uint64_t semilla,
+                             long primerID, unsigned hilos) {
+    const size_t BLOQUE = 1 << 16; // Registros por bloque de trabajo
+    const size_t inicial = personas.size();
+    const size_t total = inicial + n;
+    
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+    
+    // Crecimiento geométrico: agregar de a poco no recopia la colección cada vez
+    if (personas.capacity() < total) {
+        personas.reserve(std::max(total, 2 * personas.capacity()));
+    }
+    personas.resize(total); // Filas nuevas vacías: cada hilo escribe en su tramo
+    std::atomic<size_t> siguienteBloque(inicial);
+    
+    auto trabajador = [&]() {
+        for (;;) {
+            size_t inicio = siguienteBloque.fetch_add(BLOQUE);
+            if (inicio >= total) {
+                break;
+            }
+            size_t fin = std::min(inicio + BLOQUE, total);
+            for (size_t i = inicio; i < fin; ++i) {
+                MotorAleatorio motor(semillaRegistro(semilla, i));
+                personas[i] = generarPersona(motor, primerID + static_cast<long>(i - inicial));
+            }
+        }
+    };
+    
+    std::vector<std::thread> grupo;
+    for (unsigned h = 1; h < hilos; ++h) {
+        grupo.emplace_back(trabajador);
+    }
+    trabajador(); // El hilo principal también trabaja
+    for (auto& t : grupo) {
+        t.join();
+    }
+}
+
 /**
  * Implementación de buscarPorID.
  * 
  * POR QUÉ: Encontrar una persona por su ID en una colección.
- * CÓMO: Usando un algoritmo de búsqueda secuencial (lineal).
+ * CÓMO: Búsqueda secuencial (lineal) con buscarPosicionPorID.
  * PARA QUÉ: Para operaciones de búsqueda en la aplicación.
  */
 const Persona* buscarPorID(const std::vector<Persona>& personas, const std::string& id) {
-    // Usa find_if con una lambda para buscar por ID
-    auto it = std::find_if(personas.begin(), personas.end(),
-        [&id](const Persona& p) { return p.getId() == id; });
-    
-    if (it != personas.end()) {
-        return &(*it); // Devuelve puntero a la persona encontrada
-    } else {
-        return nullptr; // No encontrado
+    // Recorrido compartido con la instantánea: compara string_view, sin copias
+    long fila = buscarPosicionPorID(personas, id);
+    return fila >= 0 ? &personas[fila] : nullptr;
+}
+
+/**
+ * Implementación de buscarPorID con índice.
+ * 
+ * POR QUÉ: Evitar el recorrido completo de la colección.
+ * CÓMO: El índice devuelve la fila; se valida el rango antes de acceder.
+ * PARA QUÉ: Búsqueda por ID desde el menú en tiempo constante.
+ */
+const Persona* buscarPorID(const std::vector<Persona>& personas, const IndiceID& indice,
+                           const std::string& id) {
+    long fila = indice.buscar(id);
+    if (fila < 0 || static_cast<size_t>(fila) >= personas.size()) {
+        return nullptr;
     }
+    return &personas[fila];
 }
\ No newline at end of file
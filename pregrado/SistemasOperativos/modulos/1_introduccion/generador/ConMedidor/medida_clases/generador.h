@@ -2,18 +2,59 @@
 #define GENERADOR_H
 
 #include "persona.h"
+#include "indice_id.h"
+#include <cstdint>
 #include <vector>
 
+// Primer número de cédula asignado por los generadores
+const long ID_INICIAL = 1000000000;
+
+/**
+ * Motor aleatorio SplitMix64 sin estado compartido.
+ * 
+ * POR QUÉ: rand() y el std::mt19937 estático de randomDouble son globales y no
+ *          se pueden usar desde varios hilos a la vez.
+ * CÓMO: Un contador de 64 bits que avanza una constante fija y se mezcla con
+ *       multiplicaciones y desplazamientos; cada copia es independiente.
+ * PARA QUÉ: Dar a cada registro (y a cada hilo) su propio generador reproducible.
+ */
+class MotorAleatorio {
+public:
+    explicit MotorAleatorio(uint64_t semilla) : estado(semilla) {}
+    
+    // Siguiente número de 64 bits
+    uint64_t siguiente() {
+        uint64_t z = (estado += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+    
+    // Entero uniforme en [0, n) (multiplicación de 32x32 bits, sin división)
+    uint32_t entero(uint32_t n) {
+        return static_cast<uint32_t>(((siguiente() >> 32) * n) >> 32);
+    }
+    
+    // Decimal uniforme en [min, max) con 53 bits de precisión
+    double real(double min, double max) {
+        return min + (max - min) * ((siguiente() >> 11) * (1.0 / 9007199254740992.0));
+    }
+
+private:
+    uint64_t estado;
+};
+
 // Funciones para generación de datos aleatorios
 
 /**
  * Genera una fecha de nacimiento aleatoria entre 1960 y 2010.
  * 
  * POR QUÉ: Simular fechas realistas para personas.
- * CÓMO: Combinando números aleatorios para día, mes y año.
+ * CÓMO: Combinando números aleatorios para día, mes y año en una Fecha empaquetada
+ *       (sin armar texto).
  * PARA QUÉ: Inicializar el atributo fechaNacimiento de Persona.
  */
-std::string generarFechaNacimiento();
+Fecha generarFechaNacimiento();
 
 /**
  * Genera un ID único secuencial.
@@ -42,6 +83,36 @@ double randomDouble(double min, double max);
  */
 Persona generarPersona();
 
+/**
+ * Semilla del registro i de una colección.
+ * 
+ * POR QUÉ: Que el registro i no dependa de qué hilo lo genere ni en qué orden.
+ * CÓMO: Mezcla (semilla, i) con la función de SplitMix64.
+ * PARA QUÉ: Resultados idénticos para la misma semilla, con cualquier número de hilos.
+ */
+uint64_t semillaRegistro(uint64_t semilla, uint64_t i);
+
+/**
+ * Genera una fecha de nacimiento con un motor propio.
+ * 
+ * POR QUÉ: Versión segura para hilos de generarFechaNacimiento().
+ * CÓMO: Mismos rangos (día 1-28, mes 1-12, año 1960-2009) tomados del motor.
+ * PARA QUÉ: Generación paralela determinista.
+ */
+Fecha generarFechaNacimiento(MotorAleatorio& motor);
+
+/**
+ * Crea una persona con datos aleatorios tomados de un motor propio.
+ * 
+ * POR QUÉ: generarPersona() depende de estado global (rand(), contador de IDs).
+ * CÓMO: Misma lógica de campos, pero los números salen del motor y el ID se recibe.
+ * PARA QUÉ: Poder generar personas en paralelo y de forma reproducible.
+ * 
+ * @param motor Motor aleatorio del registro.
+ * @param numeroId Número de cédula a asignar.
+ */
+Persona generarPersona(MotorAleatorio& motor, long numeroId);
+
 /**
  * Genera una colección (vector) de n personas.
  * 
@@ -51,6 +122,43 @@ Persona generarPersona();
  */
 std::vector<Persona> generarColeccion(int n);
 
+/**
+ * Genera una colección de n personas usando varios hilos.
+ * 
+ * POR QUÉ: generarColeccion() es secuencial y tarda minutos con 100M registros.
+ * CÓMO: Pre-dimensiona el vector y reparte bloques fijos de registros entre los
+ *       hilos; el registro i se genera con su propio motor (semillaRegistro(semilla, i))
+ *       y cédula ID_INICIAL + i, y se escribe en su posición final.
+ * PARA QUÉ: Escalar casi linealmente con los núcleos y obtener exactamente los
+ *           mismos datos para la misma semilla, sin importar el número de hilos.
+ * 
+ * @param n Número de personas.
+ * @param semilla Semilla de la colección.
+ * @param hilos Número de hilos (0 = todos los núcleos disponibles).
+ */
+std::vector<Persona> generarColeccionParalela(int n, uint64_t semilla, unsigned hilos);
+
+/**
+ * Agrega n personas al final de una colección usando varios hilos.
+ * 
+ * POR QUÉ: Crecer una colección de 50M registros no debe exigir regenerarla completa.
+ * CÓMO: Si falta capacidad, la reserva crece al menos al doble (crecimiento
+ *       geométrico: cada registro se mueve O(1) veces en promedio); luego los
+ *       hilos llenan solo las filas nuevas. La fila i usa semillaRegistro(semilla, i)
+ *       y la cédula primerID + (i - filaInicial).
+ * PARA QUÉ: Costo proporcional a lo agregado. Con la misma semilla y
+ *           primerID = ID_INICIAL + tamaño actual, el resultado es idéntico a
+ *           generar la colección completa con generarColeccionParalela.
+ * 
+ * @param personas Colección que crece.
+ * @param n Número de personas a agregar.
+ * @param semilla Semilla de la colección.
+ * @param primerID Cédula de la primera persona agregada.
+ * @param hilos Número de hilos (0 = todos los núcleos disponibles).
+ */
+void agregarPersonasParalelo(std::vector<Persona>& personas, size_t n, uint64_t semilla,
+                             long primerID, unsigned hilos);
+
 /**
  * Busca una persona por ID en un vector de personas.
  * 
@@ -64,4 +172,19 @@ std::vector<Persona> generarColeccion(int n);
  */
 const Persona* buscarPorID(const std::vector<Persona>& personas, const std::string& id);
 
+/**
+ * Busca una persona por ID usando el índice hash.
+ * 
+ * POR QUÉ: La búsqueda lineal es O(n) y compara strings en cada paso.
+ * CÓMO: Consulta el IndiceID (cédula -> fila) y accede directo al vector.
+ * PARA QUÉ: Búsquedas O(1) sobre colecciones de decenas de millones.
+ * 
+ * @param personas Vector de personas indexado.
+ * @param indice Índice construido sobre ese mismo vector.
+ * @param id ID a buscar.
+ * @return Puntero a la persona encontrada o nullptr si no se encuentra.
+ */
+const Persona* buscarPorID(const std::vector<Persona>& personas, const IndiceID& indice,
+                           const std::string& id);
+
 #endif // GENERADOR_H
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "indice_id.h"
+#include <algorithm> // std::max, std::min
+
+/**
+ * Calcula la ranura inicial de una clave.
+ *
+ * POR QUÉ: Las cédulas son secuenciales; usarlas directamente agruparía las claves.
+ * CÓMO: Hash multiplicativo de Fibonacci: toma los bits altos del producto.
+ * PARA QUÉ: Mantener cortas las secuencias de sondeo.
+ */
+size_t IndiceID::posicion(uint64_t clave) const {
+    return static_cast<size_t>((clave * 0x9E3779B97F4A7C15ULL) >> desplazamiento);
+}
+
+// Deja la tabla vacía con la potencia de 2 >= 2 * elementos ranuras
+void IndiceID::dimensionar(size_t elementos) {
+    size_t capacidad = 16;
+    int bits = 4;
+    while (capacidad < elementos * 2) {
+        capacidad <<= 1;
+        ++bits;
+    }
+    ranuras.assign(capacidad, Ranura{VACIA, 0});
+    mascara = capacidad - 1;
+    desplazamiento = 64 - bits;
+    ocupadas = 0;
+}
+
+// Inserción con sondeo lineal; una clave repetida queda con la última fila
+void IndiceID::insertar(uint64_t clave, uint32_t fila) {
+    size_t i = posicion(clave);
+    while (ranuras[i].clave != VACIA && ranuras[i].clave != clave) {
+        i = (i + 1) & mascara; // Sondeo lineal
+    }
+    if (ranuras[i].clave == VACIA) {
+        ++ocupadas;
+    }
+    ranuras[i] = Ranura{clave, fila};
+    maxima = std::max(maxima, clave);
+}
+
+/**
+ * Implementación de construir.
+ *
+ * POR QUÉ: Indexar toda la colección de una vez.
+ * CÓMO: Reserva la tabla completa y hace una inserción con sondeo lineal por fila.
+ * PARA QUÉ: Evitar redimensionamientos durante la construcción.
+ */
+void IndiceID::construir(const std::vector<Persona>& personas) {
+    dimensionar(personas.size());
+    maxima = 0;
+    for (size_t fila = 0; fila < personas.size(); ++fila) {
+        uint64_t cedula;
+        if (!convertirCedula(personas[fila].getId(), cedula)) {
+            continue; // IDs no numéricos no se indexan
+        }
+        insertar(cedula, static_cast<uint32_t>(fila));
+    }
+}
+
+/**
+ * Implementación de agregar.
+ *
+ * POR QUÉ: Indexar solo lo nuevo.
+ * CÓMO: Si hace falta, rehash al doble (o más) con las ranuras actuales y luego
+ *       inserción de las filas nuevas.
+ * PARA QUÉ: Costo amortizado O(filas agregadas).
+ */
+void IndiceID::agregar(const std::vector<Persona>& personas, size_t desde) {
+    const size_t necesarias = ocupadas + (personas.size() - std::min(desde, personas.size()));
+    if (ranuras.empty() || necesarias * 2 > ranuras.size()) {
+        std::vector<Ranura> anteriores;
+        anteriores.swap(ranuras);
+        dimensionar(std::max(necesarias, anteriores.size())); // Al menos el doble de ranuras
+        for (const Ranura& r : anteriores) {
+            if (r.clave != VACIA) {
+                insertar(r.clave, r.fila);
+            }
+        }
+    }
+    for (size_t fila = desde; fila < personas.size(); ++fila) {
+        uint64_t cedula;
+        if (convertirCedula(personas[fila].getId(), cedula)) {
+            insertar(cedula, static_cast<uint32_t>(fila));
+        }
+    }
+}
+
+/**
+ * Implementación de buscar.
+ *
+ * POR QUÉ: Recuperar la fila de un ID sin recorrer la colección.
+ * CÓMO: Sondeo lineal desde la ranura inicial hasta hallar la clave o una ranura vacía.
+ * PARA QUÉ: Búsqueda por ID en O(1) esperado.
+ */
+long IndiceID::buscar(const std::string& id) const {
+    uint64_t cedula;
+    if (ranuras.empty() || !convertirCedula(id, cedula)) {
+        return -1;
+    }
+    size_t i = posicion(cedula);
+    while (ranuras[i].clave != VACIA) {
+        if (ranuras[i].clave == cedula) {
+            return static_cast<long>(ranuras[i].fila);
+        }
+        i = (i + 1) & mascara;
+    }
+    return -1;
+}
+
+bool IndiceID::eliminar(const std::string& id) {
+    uint64_t cedula;
+    if (ranuras.empty() || !convertirCedula(id, cedula)) {
+        return false;
+    }
+    size_t hueco = posicion(cedula);
+    while (ranuras[hueco].clave != cedula) {
+        if (ranuras[hueco].clave == VACIA) {
+            return false;
+        }
+        hueco = (hueco + 1) & mascara;
+    }
+    // Una clave puede pasar al hueco si su ranura inicial no está entre el hueco y ella
+    for (size_t i = (hueco + 1) & mascara; ranuras[i].clave != VACIA; i = (i + 1) & mascara) {
+        size_t inicial = posicion(ranuras[i].clave);
+        if (((i - inicial) & mascara) >= ((i - hueco) & mascara)) {
+            ranuras[hueco] = ranuras[i];
+            hueco = i;
+        }
+    }
+    ranuras[hueco].clave = VACIA;
+    --ocupadas;
+    return true;
+}
+
+size_t IndiceID::memoria_bytes() const {
+    return ranuras.capacity() * sizeof(Ranura);
+}
+
+void IndiceID::limpiar() {
+    std::vector<Ranura>().swap(ranuras); // Libera la memoria de verdad
+    mascara = 0;
+    desplazamiento = 63;
+    ocupadas = 0;
+    maxima = 0;
+}
+
+/**
+ * Implementación de convertirCedula.
+ *
+ * POR QUÉ: Validar y convertir la entrada del usuario y los IDs generados.
+ * CÓMO: Recorre los caracteres acumulando dígitos en base 10. Rechaza los ceros
+ *       a la izquierda: "0123" y "123" darían la misma clave siendo IDs distintos.
+ * PARA QUÉ: Obtener la clave numérica del índice, una por cada texto.
+ */
+bool IndiceID::convertirCedula(const std::string& id, uint64_t& cedula) {
+    if (id.empty() || id.size() > 19 || (id.size() > 1 && id[0] == '0')) {
+        return false;
+    }
+    uint64_t valor = 0;
+    for (char c : id) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        valor = valor * 10 + static_cast<uint64_t>(c - '0');
+    }
+    if (valor == VACIA) {
+        return false;
+    }
+    cedula = valor;
+    return true;
+}
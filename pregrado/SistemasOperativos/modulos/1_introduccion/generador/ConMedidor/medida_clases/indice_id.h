@@ -0,0 +1,105 @@
+#ifndef INDICE_ID_H
+#define INDICE_ID_H
+
+#include "persona.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Índice hash de direccionamiento abierto sobre la cédula numérica.
+ *
+ * POR QUÉ: La búsqueda lineal por ID recorre toda la colección y compara strings.
+ * CÓMO: Tabla plana (sin nodos ni punteros) con sondeo lineal; la clave es la
+ *       cédula convertida a entero y el valor es la posición en el vector.
+ * PARA QUÉ: Búsquedas por ID en tiempo O(1) esperado, sin asignar memoria.
+ */
+class IndiceID {
+public:
+    /**
+     * Construye el índice a partir de una colección completa.
+     *
+     * POR QUÉ: El índice se crea una sola vez, cuando termina la generación.
+     * CÓMO: Dimensiona la tabla a la potencia de 2 >= 2n (carga <= 50%) e inserta cada fila.
+     * PARA QUÉ: Dejar listo el índice para todas las búsquedas posteriores.
+     */
+    void construir(const std::vector<Persona>& personas);
+
+    /**
+     * Indexa las filas agregadas al final de la colección.
+     *
+     * POR QUÉ: Reconstruir el índice al agregar 1M personas a 50M costaría O(total).
+     * CÓMO: Inserta solo las filas [desde, size()). Si la carga pasaría del 50%,
+     *       duplica la tabla reinsertando las ranuras ocupadas (sin releer las
+     *       personas); como la tabla crece al doble, el costo amortizado por fila
+     *       agregada es O(1).
+     * PARA QUÉ: Mantener el índice al día con costo proporcional a lo agregado.
+     */
+    void agregar(const std::vector<Persona>& personas, size_t desde);
+
+    /**
+     * Busca la fila asociada a un ID.
+     *
+     * @param id Cédula en formato texto.
+     * @return Posición en el vector, o -1 si no existe o el ID no es numérico.
+     */
+    long buscar(const std::string& id) const;
+
+    /**
+     * Quita un ID del índice.
+     *
+     * POR QUÉ: Con sondeo lineal, vaciar la ranura cortaría la secuencia de sondeo
+     *          de las claves que vienen después.
+     * CÓMO: Borrado por desplazamiento hacia atrás: las claves siguientes del mismo
+     *       grupo que podrían ocupar el hueco se corren a él, sin marcas de borrado.
+     * PARA QUÉ: Las búsquedas siguen siendo O(1) esperado tras muchas eliminaciones.
+     * @return true si el ID estaba indexado.
+     */
+    bool eliminar(const std::string& id);
+
+    /**
+     * Memoria ocupada por la tabla del índice.
+     *
+     * PARA QUÉ: Reportar el costo del índice separado del costo de los datos.
+     * @return Tamaño en bytes.
+     */
+    size_t memoria_bytes() const;
+
+    bool vacio() const { return ranuras.empty(); }
+    size_t size() const { return ocupadas; }
+
+    // Mayor cédula indexada (0 si no hay ninguna)
+    uint64_t cedulaMaxima() const { return maxima; }
+    void limpiar();
+
+    /**
+     * Convierte una cédula en texto a entero.
+     *
+     * POR QUÉ: Comparar enteros es más barato que comparar strings.
+     * CÓMO: Acepta solo dígitos (máximo 19 para no desbordar 64 bits) y sin ceros
+     *       a la izquierda, para que cada clave corresponda a un único texto.
+     * @return true si el texto es una cédula válida.
+     */
+    static bool convertirCedula(const std::string& id, uint64_t& cedula);
+
+private:
+    // Ranura de la tabla: 16 bytes, varias ranuras por línea de caché
+    struct Ranura {
+        uint64_t clave; // Cédula (VACIA si la ranura está libre)
+        uint32_t fila;  // Posición de la persona en el vector
+    };
+
+    static constexpr uint64_t VACIA = UINT64_MAX;
+
+    size_t posicion(uint64_t clave) const;
+    void dimensionar(size_t elementos); // Tabla vacía con capacidad para 'elementos' (carga <= 50%)
+    void insertar(uint64_t clave, uint32_t fila);
+
+    std::vector<Ranura> ranuras; // Tabla plana de tamaño potencia de 2
+    size_t mascara = 0;          // ranuras.size() - 1
+    int desplazamiento = 63;     // 64 - log2(ranuras.size())
+    size_t ocupadas = 0;         // Ranuras con clave
+    uint64_t maxima = 0;         // Mayor cédula insertada
+};
+
+#endif // INDICE_ID_H
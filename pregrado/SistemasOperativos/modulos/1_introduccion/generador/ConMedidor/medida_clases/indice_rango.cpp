@@ -0,0 +1,383 @@
+#include "indice_rango.h"
+#include <algorithm> // std::sort, std::merge, std::lower_bound
+#include <limits>    // std::numeric_limits
+#include <utility>   // std::move
+
+double valorCampo(const Persona& p, CampoFinanciero campo) {
+    switch (campo) {
+        case CampoFinanciero::Ingresos:   return p.getIngresosAnuales();
+        case CampoFinanciero::Patrimonio: return p.getPatrimonio();
+        case CampoFinanciero::Deudas:     return p.getDeudas();
+    }
+    return 0.0;
+}
+
+void asignarCampo(Persona& p, CampoFinanciero campo, double valor) {
+    switch (campo) {
+        case CampoFinanciero::Ingresos:   p.setIngresosAnuales(valor); break;
+        case CampoFinanciero::Patrimonio: p.setPatrimonio(valor); break;
+        case CampoFinanciero::Deudas:     p.setDeudas(valor); break;
+    }
+}
+
+std::string nombreCampo(CampoFinanciero campo) {
+    switch (campo) {
+        case CampoFinanciero::Ingresos:   return "Ingresos anuales";
+        case CampoFinanciero::Patrimonio: return "Patrimonio";
+        case CampoFinanciero::Deudas:     return "Deudas";
+    }
+    return "";
+}
+
+/**
+ * Implementación de construir.
+ *
+ * POR QUÉ: El índice es estático: se construye una vez por colección.
+ * CÓMO: Ordena pares (valor, fila); guarda las filas en orden ascendente y
+ *       reparte los valores en el arreglo Eytzinger.
+ * PARA QUÉ: Dejar listas las búsquedas logarítmicas.
+ */
+void IndiceRango::construir(const std::vector<Persona>& personas, CampoFinanciero campo) {
+    this->campo = campo;
+    std::vector<Entrada> entradas;
+    entradas.reserve(personas.size());
+    for (size_t i = 0; i < personas.size(); ++i) {
+        entradas.push_back(Entrada{valorCampo(personas[i], campo), static_cast<uint32_t>(i)});
+    }
+    std::sort(entradas.begin(), entradas.end());
+    cargar(entradas);
+}
+
+void IndiceRango::cargar(const std::vector<Entrada>& ordenadas) {
+    const size_t n = ordenadas.size();
+    std::vector<double> ordenados(n);
+    ordenFilas.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        ordenados[i] = ordenadas[i].valor;
+        ordenFilas[i] = ordenadas[i].fila;
+    }
+
+    eytzinger.assign(n + 1, 0.0);
+    rangoNodo.assign(n + 1, 0);
+    llenarEytzinger(ordenados, 0, 1);
+    tramos.clear();
+    bajas.clear();
+    entradasTramos = 0;
+}
+
+/**
+ * Implementación de agregar.
+ *
+ * POR QUÉ: Indexar filas nuevas sin tocar el arreglo principal.
+ * CÓMO: Ordena solo las filas nuevas; fusiona tramos de tamaño parecido y
+ *       reconstruye todo cuando los tramos alcanzan al arreglo principal.
+ * PARA QUÉ: Crecimiento incremental con consultas todavía logarítmicas.
+ */
+void IndiceRango::agregar(const std::vector<Persona>& personas, size_t desde) {
+    std::vector<Entrada> nuevo;
+    nuevo.reserve(personas.size() - std::min(desde, personas.size()));
+    for (size_t i = desde; i < personas.size(); ++i) {
+        nuevo.push_back(Entrada{valorCampo(personas[i], campo), static_cast<uint32_t>(i)});
+    }
+    if (nuevo.empty()) {
+        return;
+    }
+    std::sort(nuevo.begin(), nuevo.end());
+    apilar(tramos, std::move(nuevo));
+
+    // Los tramos ya pesan tanto como el arreglo principal: se pliega todo en uno
+    if (entradasTramos >= ordenFilas.size()) {
+        plegar();
+    }
+}
+
+void IndiceRango::actualizar(uint32_t fila, double anterior, double nuevo) {
+    if (anterior == nuevo) {
+        return;
+    }
+    apilar(bajas, {Entrada{anterior, fila}});
+    apilar(tramos, {Entrada{nuevo, fila}});
+    if (entradasTramos >= ordenFilas.size()) {
+        plegar();
+    }
+}
+
+void IndiceRango::eliminar(uint32_t fila, double valor) {
+    apilar(bajas, {Entrada{valor, fila}});
+    if (entradasTramos >= ordenFilas.size()) {
+        plegar();
+    }
+}
+
+// Fusiona como al sumar 1 en binario: O(log n) tramos de tamaños decrecientes
+void IndiceRango::apilar(std::vector<std::vector<Entrada>>& pila, std::vector<Entrada> nuevo) {
+    entradasTramos += nuevo.size();
+    pila.push_back(std::move(nuevo));
+    while (pila.size() >= 2 && pila[pila.size() - 2].size() <= pila.back().size()) {
+        std::vector<Entrada>& anterior = pila[pila.size() - 2];
+        std::vector<Entrada> fusion(anterior.size() + pila.back().size());
+        std::merge(anterior.begin(), anterior.end(), pila.back().begin(), pila.back().end(),
+                   fusion.begin());
+        pila.pop_back();
+        pila.back() = std::move(fusion);
+    }
+}
+
+/**
+ * Implementación de plegar.
+ *
+ * POR QUÉ: Con muchos tramos cada consulta fusiona más cursores.
+ * CÓMO: Un recorrido ascendente completo ya entrega las entradas vivas
+ *       ordenadas (sin las anuladas por bajas); se cargan como arreglo nuevo.
+ * PARA QUÉ: Volver a un solo arreglo sin releer las personas ni reordenar.
+ */
+void IndiceRango::plegar() {
+    std::vector<Entrada> vivas;
+    vivas.reserve(ordenFilas.size() + entradasTramos);
+    const double infinito = std::numeric_limits<double>::infinity();
+    recorrer(-infinito, infinito, true, [&](const Entrada& e) {
+        vivas.push_back(e);
+        return true;
+    });
+    cargar(vivas);
+}
+
+/**
+ * Recorrido en orden del árbol implícito.
+ *
+ * CÓMO: Visita hijo izquierdo (2k), el nodo k y el hijo derecho (2k+1);
+ *       el i-ésimo nodo visitado recibe el i-ésimo valor ordenado.
+ * @return Siguiente posición ordenada por asignar.
+ */
+size_t IndiceRango::llenarEytzinger(const std::vector<double>& ordenados, size_t i, size_t k) {
+    if (k <= ordenados.size()) {
+        i = llenarEytzinger(ordenados, i, 2 * k);
+        eytzinger[k] = ordenados[i];
+        rangoNodo[k] = static_cast<uint32_t>(i);
+        ++i;
+        i = llenarEytzinger(ordenados, i, 2 * k + 1);
+    }
+    return i;
+}
+
+/**
+ * Búsqueda sin saltos en el arreglo Eytzinger.
+ *
+ * CÓMO: Baja por el árbol (k = 2k + [valor < x]) precargando los nodos de
+ *       cuatro niveles más abajo; al final los bits de k indican en qué nodo
+ *       se giró a la izquierda por última vez, que es la respuesta.
+ * @return Nodo del primer valor que cumple (0 si ninguno cumple).
+ */
+size_t IndiceRango::buscarNodo(double x, bool estricto) const {
+    const size_t n = ordenFilas.size();
+    size_t k = 1;
+    while (k <= n) {
+        __builtin_prefetch(eytzinger.data() + std::min(16 * k, n));
+        bool derecha = estricto ? !(x < eytzinger[k]) : (eytzinger[k] < x);
+        k = 2 * k + derecha;
+    }
+    // Quita los giros a la derecha del final (bits 1) y el último giro a la izquierda
+    return k >> __builtin_ffsll(~static_cast<long long>(k));
+}
+
+size_t IndiceRango::buscarRango(double x, bool estricto) const {
+    size_t k = buscarNodo(x, estricto);
+    return k == 0 ? ordenFilas.size() : rangoNodo[k];
+}
+
+/**
+ * Sucesor en orden del árbol implícito.
+ *
+ * CÓMO: Si hay hijo derecho, su descendiente más a la izquierda; si no, se sube
+ *       mientras el nodo sea hijo derecho y el sucesor es el padre.
+ * PARA QUÉ: Recorrer valores en orden ascendente con costo O(1) amortizado.
+ */
+size_t IndiceRango::siguienteNodo(size_t k) const {
+    const size_t n = ordenFilas.size();
+    if (2 * k + 1 <= n) {
+        k = 2 * k + 1;
+        while (2 * k <= n) {
+            k = 2 * k;
+        }
+        return k;
+    }
+    while (k & 1) {
+        k >>= 1;
+    }
+    return k >> 1;
+}
+
+// Espejo de siguienteNodo: hijo izquierdo y luego todo a la derecha, o subir
+// mientras el nodo sea hijo izquierdo
+size_t IndiceRango::anteriorNodo(size_t k) const {
+    const size_t n = ordenFilas.size();
+    if (2 * k <= n) {
+        k = 2 * k;
+        while (2 * k + 1 <= n) {
+            k = 2 * k + 1;
+        }
+        return k;
+    }
+    while (k != 0 && !(k & 1)) {
+        k >>= 1;
+    }
+    return k >> 1;
+}
+
+size_t IndiceRango::nodoExtremo(bool izquierda) const {
+    const size_t n = ordenFilas.size();
+    if (n == 0) {
+        return 0;
+    }
+    size_t k = 1;
+    while (2 * k + (izquierda ? 0 : 1) <= n) {
+        k = 2 * k + (izquierda ? 0 : 1);
+    }
+    return k;
+}
+
+/**
+ * Implementación de recorrer.
+ *
+ * CÓMO: Fusión de k vías: un cursor en el arreglo principal (recorrido en orden
+ *       con siguienteNodo o anteriorNodo) y uno por tramo de altas; en cada paso
+ *       sale la primera (valor, fila) en el sentido pedido. Los cursores de bajas
+ *       avanzan a la par: si uno queda sobre la misma entrada, ambas se anulan.
+ */
+template <typename Visitar>
+void IndiceRango::recorrer(double min, double max, bool ascendente, Visitar visitar) const {
+    if (min > max) {
+        return;
+    }
+    // Cursor sobre un tramo: avanza de 'pos' hacia 'fin' (excluido) con 'paso'
+    struct Cursor {
+        const std::vector<Entrada>* tramo;
+        ptrdiff_t pos, fin;
+    };
+    const ptrdiff_t paso = ascendente ? 1 : -1;
+    auto abrir = [&](const std::vector<std::vector<Entrada>>& pila) {
+        std::vector<Cursor> cursores;
+        for (const auto& tramo : pila) {
+            auto desde = std::lower_bound(tramo.begin(), tramo.end(), min,
+                                          [](const Entrada& e, double x) { return e.valor < x; });
+            auto hasta = std::upper_bound(desde, tramo.end(), max,
+                                          [](double x, const Entrada& e) { return x < e.valor; });
+            ptrdiff_t d = desde - tramo.begin(), h = hasta - tramo.begin();
+            if (d < h) {
+                cursores.push_back(ascendente ? Cursor{&tramo, d, h} : Cursor{&tramo, h - 1, d - 1});
+            }
+        }
+        return cursores;
+    };
+    std::vector<Cursor> altas = abrir(tramos);
+    std::vector<Cursor> anuladas = abrir(bajas);
+    // 'a' sale antes que 'b' en el sentido del recorrido
+    auto antes = [ascendente](const Entrada& a, const Entrada& b) { return ascendente ? a < b : b < a; };
+
+    size_t nodo = 0;
+    if (!ordenFilas.empty()) {
+        if (ascendente) {
+            nodo = buscarNodo(min, false);
+        } else {
+            size_t k = buscarNodo(max, true); // Primer valor > max: se empieza en su anterior
+            nodo = k == 0 ? nodoExtremo(false) : anteriorNodo(k);
+        }
+    }
+
+    while (true) {
+        bool hay = nodo != 0 && eytzinger[nodo] >= min && eytzinger[nodo] <= max;
+        Entrada actual{hay ? eytzinger[nodo] : 0.0, hay ? ordenFilas[rangoNodo[nodo]] : 0};
+        Cursor* origen = nullptr; // nullptr = arreglo principal
+        for (Cursor& c : altas) {
+            if (c.pos != c.fin && (!hay || antes((*c.tramo)[c.pos], actual))) {
+                actual = (*c.tramo)[c.pos];
+                origen = &c;
+                hay = true;
+            }
+        }
+        if (!hay) {
+            return;
+        }
+        if (origen) {
+            origen->pos += paso;
+        } else {
+            nodo = ascendente ? siguienteNodo(nodo) : anteriorNodo(nodo);
+        }
+
+        // Cada baja anula una sola entrada igual
+        bool anulada = false;
+        for (Cursor& c : anuladas) {
+            while (c.pos != c.fin && antes((*c.tramo)[c.pos], actual)) {
+                c.pos += paso;
+            }
+            if (c.pos != c.fin && !antes(actual, (*c.tramo)[c.pos])) {
+                c.pos += paso;
+                anulada = true;
+                break;
+            }
+        }
+        if (!anulada && !visitar(actual)) {
+            return;
+        }
+    }
+}
+
+size_t IndiceRango::contar(double min, double max) const {
+    if (vacio() || min > max) {
+        return 0;
+    }
+    size_t total = ordenFilas.empty() ? 0 : buscarRango(max, true) - buscarRango(min, false);
+    auto enRango = [min, max](const std::vector<Entrada>& tramo) {
+        auto desde = std::lower_bound(tramo.begin(), tramo.end(), min,
+                                      [](const Entrada& e, double x) { return e.valor < x; });
+        auto hasta = std::upper_bound(desde, tramo.end(), max,
+                                      [](double x, const Entrada& e) { return x < e.valor; });
+        return static_cast<size_t>(hasta - desde);
+    };
+    for (const auto& tramo : tramos) {
+        total += enRango(tramo);
+    }
+    for (const auto& tramo : bajas) {
+        total -= enRango(tramo); // Cada baja tiene su alta en el mismo rango
+    }
+    return total;
+}
+
+void IndiceRango::filas(double min, double max, std::vector<uint32_t>& salida, size_t limite) const {
+    if (vacio() || salida.size() >= limite) {
+        return;
+    }
+    recorrer(min, max, true, [&](const Entrada& e) {
+        salida.push_back(e.fila);
+        return salida.size() < limite;
+    });
+}
+
+bool IndiceRango::minimo(uint32_t& fila) const {
+    bool hay = false;
+    const double infinito = std::numeric_limits<double>::infinity();
+    recorrer(-infinito, infinito, true, [&](const Entrada& e) {
+        fila = e.fila;
+        hay = true;
+        return false;
+    });
+    return hay;
+}
+
+bool IndiceRango::maximo(uint32_t& fila) const {
+    bool hay = false;
+    const double infinito = std::numeric_limits<double>::infinity();
+    recorrer(-infinito, infinito, false, [&](const Entrada& e) {
+        fila = e.fila;
+        hay = true;
+        return false;
+    });
+    return hay;
+}
+
+size_t IndiceRango::memoria_bytes() const {
+    return eytzinger.capacity() * sizeof(double)
+         + rangoNodo.capacity() * sizeof(uint32_t)
+         + ordenFilas.capacity() * sizeof(uint32_t)
+         + entradasTramos * sizeof(Entrada);
+}
@@ -0,0 +1,149 @@
+#ifndef INDICE_RANGO_H
+#define INDICE_RANGO_H
+
+#include "persona.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Campos financieros que se pueden indexar por rango.
+ */
+enum class CampoFinanciero {
+    Ingresos,   // ingresosAnuales
+    Patrimonio, // patrimonio
+    Deudas      // deudas
+};
+
+/**
+ * Devuelve el valor de un campo financiero de una persona.
+ */
+double valorCampo(const Persona& p, CampoFinanciero campo);
+
+/**
+ * Cambia el valor de un campo financiero de una persona.
+ */
+void asignarCampo(Persona& p, CampoFinanciero campo, double valor);
+
+/**
+ * Nombre legible de un campo financiero (para menús y estadísticas).
+ */
+std::string nombreCampo(CampoFinanciero campo);
+
+/**
+ * Índice ordenado estático sobre un campo financiero (disposición Eytzinger).
+ *
+ * POR QUÉ: Preguntas como "ingresos entre 100M y 200M" exigen recorrer toda la colección.
+ * CÓMO: Los valores ordenados se guardan en orden de árbol binario implícito (Eytzinger):
+ *       el nodo k tiene hijos 2k y 2k+1, así la búsqueda baja por posiciones cercanas
+ *       en memoria y se puede precargar (prefetch) varios niveles por adelantado.
+ * PARA QUÉ: Conteo por rango, recorrido ordenado y mínimo/máximo en O(log n).
+ */
+class IndiceRango {
+public:
+    /**
+     * Construye el índice sobre un campo de la colección.
+     *
+     * CÓMO: Ordena pares (valor, fila) y los reparte en el arreglo Eytzinger
+     *       con un recorrido en orden del árbol implícito.
+     */
+    void construir(const std::vector<Persona>& personas, CampoFinanciero campo);
+
+    /**
+     * Indexa las filas agregadas al final de la colección.
+     *
+     * POR QUÉ: El arreglo Eytzinger es estático; insertar en él costaría O(total).
+     * CÓMO: Método logarítmico: las filas nuevas forman un tramo ordenado aparte y,
+     *       mientras el tramo anterior no sea más grande, se fusionan (como sumar 1
+     *       en binario), así hay O(log n) tramos. Cuando los tramos suman tanto como
+     *       el arreglo principal, todo se reconstruye en uno solo.
+     * PARA QUÉ: Costo amortizado O(log n) por fila agregada; las consultas
+     *           combinan el arreglo principal con los tramos.
+     */
+    void agregar(const std::vector<Persona>& personas, size_t desde);
+
+    /**
+     * Refleja el cambio de valor de una fila (actualización en sitio).
+     *
+     * POR QUÉ: La entrada vieja está en el arreglo estático o en un tramo y no se
+     *          puede mover sin reconstruir.
+     * CÓMO: Registra (anterior, fila) como baja y (nuevo, fila) como alta; las
+     *       bajas forman sus propios tramos ordenados y las consultas descuentan
+     *       cada baja de la entrada igual que encuentran.
+     * PARA QUÉ: Actualizar con el mismo costo amortizado O(log n) que agregar.
+     */
+    void actualizar(uint32_t fila, double anterior, double nuevo);
+
+    /**
+     * Quita una fila eliminada del índice (registra (valor, fila) como baja).
+     */
+    void eliminar(uint32_t fila, double valor);
+
+    /**
+     * Cuenta las personas con valor en [min, max].
+     *
+     * CÓMO: Dos búsquedas (límite inferior y superior) y una resta de rangos.
+     */
+    size_t contar(double min, double max) const;
+
+    /**
+     * Agrega a 'salida' las filas con valor en [min, max], en orden ascendente.
+     *
+     * @param limite Máximo de filas a devolver.
+     */
+    void filas(double min, double max, std::vector<uint32_t>& salida, size_t limite) const;
+
+    /**
+     * Fila con el valor mínimo / máximo del campo.
+     *
+     * @return false si el índice está vacío.
+     */
+    bool minimo(uint32_t& fila) const;
+    bool maximo(uint32_t& fila) const;
+
+    size_t memoria_bytes() const;
+    bool vacio() const { return ordenFilas.empty() && tramos.empty(); }
+    size_t numTramos() const { return tramos.size() + bajas.size(); }
+    CampoFinanciero getCampo() const { return campo; }
+
+private:
+    // Entrada de un tramo de filas agregadas, ordenado por (valor, fila)
+    struct Entrada {
+        double valor;
+        uint32_t fila;
+        bool operator<(const Entrada& otra) const {
+            return valor < otra.valor || (valor == otra.valor && fila < otra.fila);
+        }
+    };
+
+    // Nodo Eytzinger del primer valor >= x (o > x si estricto); 0 si ninguno cumple
+    size_t buscarNodo(double x, bool estricto) const;
+    // Rango (posición en orden ascendente) del primer valor >= x (o > x si estricto)
+    size_t buscarRango(double x, bool estricto) const;
+    // Nodo siguiente / anterior en orden ascendente (0 al terminar)
+    size_t siguienteNodo(size_t k) const;
+    size_t anteriorNodo(size_t k) const;
+    // Nodo del menor (izquierda) o mayor valor del arreglo principal
+    size_t nodoExtremo(bool izquierda) const;
+    size_t llenarEytzinger(const std::vector<double>& ordenados, size_t i, size_t k);
+    // Reemplaza todo el índice por entradas ya ordenadas (sin tramos)
+    void cargar(const std::vector<Entrada>& ordenadas);
+    // Agrega un tramo a la pila y fusiona mientras el anterior no sea mayor
+    void apilar(std::vector<std::vector<Entrada>>& pila, std::vector<Entrada> nuevo);
+    // Pliega arreglo principal, altas y bajas en un arreglo principal nuevo
+    void plegar();
+    // Visita las entradas vivas con valor en [min, max] en el sentido pedido
+    // hasta que 'visitar' devuelva false
+    template <typename Visitar>
+    void recorrer(double min, double max, bool ascendente, Visitar visitar) const;
+
+    CampoFinanciero campo = CampoFinanciero::Ingresos;
+    std::vector<double> eytzinger;    // Valores en orden Eytzinger (posición 0 sin usar)
+    std::vector<uint32_t> rangoNodo;  // Nodo Eytzinger -> posición en orden ascendente
+    std::vector<uint32_t> ordenFilas; // Posición en orden ascendente -> fila del vector
+    std::vector<std::vector<Entrada>> tramos; // Altas (filas agregadas o actualizadas), tamaños decrecientes
+    std::vector<std::vector<Entrada>> bajas;  // Entradas anuladas por actualizaciones o eliminaciones
+    size_t entradasTramos = 0;                // Total de entradas en altas y bajas
+};
+
+#endif // INDICE_RANGO_H
@@ -0,0 +1,214 @@
+#include "instantanea.h"
+#include "persona_ref.h"
+#include <cstdio>        // FILE, fopen, fwrite
+#include <cstring>       // std::memcpy, std::memcmp
+#include <iostream>
+#include <unordered_map>
+#include <fcntl.h>       // open
+#include <sys/mman.h>    // mmap, munmap
+#include <sys/stat.h>    // fstat
+#include <unistd.h>      // close
+
+namespace {
+
+const char MAGIA[8] = {'P', 'E', 'R', 'S', 'N', 'A', 'P', '\0'};
+
+// Strings de más de 65535 bytes no caben en la referencia de 16 bits de largo
+const size_t LARGO_MAXIMO = 0xFFFF;
+
+/**
+ * Montículo de strings con deduplicación opcional.
+ *
+ * POR QUÉ: Nombres, apellidos y ciudades se repiten millones de veces.
+ * CÓMO: Un mapa string -> referencia evita guardar dos veces el mismo valor.
+ */
+class Monticulo {
+public:
+    uint64_t agregar(const std::string& texto, bool deduplicar) {
+        if (deduplicar) {
+            auto it = vistos.find(texto);
+            if (it != vistos.end()) {
+                return it->second;
+            }
+        }
+        size_t largo = texto.size() < LARGO_MAXIMO ? texto.size() : LARGO_MAXIMO;
+        uint64_t referencia = (static_cast<uint64_t>(datos.size()) << 16) | largo;
+        datos.append(texto, 0, largo);
+        if (deduplicar) {
+            vistos.emplace(texto, referencia);
+        }
+        return referencia;
+    }
+
+    const std::string& bytes() const { return datos; }
+
+private:
+    std::string datos;
+    std::unordered_map<std::string, uint64_t> vistos;
+};
+
+} // namespace
+
+/**
+ * Implementación de guardarInstantanea.
+ *
+ * POR QUÉ: Persistir una colección para reutilizarla sin regenerarla.
+ * CÓMO: Cabecera provisional, registros por bloques, montículo al final y
+ *       reescritura de la cabecera con los desplazamientos definitivos.
+ * PARA QUÉ: Archivos listos para mmap.
+ */
+bool guardarInstantanea(const std::vector<Persona>& personas, const std::string& ruta) {
+    FILE* archivo = std::fopen(ruta.c_str(), "wb");
+    if (!archivo) {
+        std::perror(("Error al abrir " + ruta).c_str());
+        return false;
+    }
+
+    CabeceraInstantanea cabecera;
+    std::memset(&cabecera, 0, sizeof(cabecera));
+    std::memcpy(cabecera.magia, MAGIA, sizeof(MAGIA));
+    cabecera.version = VERSION_INSTANTANEA;
+    cabecera.tamRegistro = sizeof(RegistroInstantanea);
+    cabecera.numRegistros = personas.size();
+    cabecera.inicioRegistros = sizeof(CabeceraInstantanea);
+
+    bool ok = std::fwrite(&cabecera, sizeof(cabecera), 1, archivo) == 1;
+
+    // Registros por bloques para no duplicar la colección en memoria
+    const size_t BLOQUE = 1 << 16;
+    std::vector<RegistroInstantanea> bloque;
+    bloque.reserve(BLOQUE);
+    Monticulo monticulo;
+
+    for (size_t i = 0; i < personas.size() && ok; ++i) {
+        const Persona& p = personas[i];
+        RegistroInstantanea r;
+        std::memset(&r, 0, sizeof(r));
+        r.nombre = monticulo.agregar(p.getNombre(), true);
+        r.apellido = monticulo.agregar(p.getApellido(), true);
+        r.id = monticulo.agregar(p.getId(), false); // Los IDs son únicos: no se deduplican
+        r.ciudadNacimiento = monticulo.agregar(p.getCiudadNacimiento(), true);
+        r.fechaNacimiento = p.getFechaNacimiento().getCodigo();
+        r.ingresosAnuales = p.getIngresosAnuales();
+        r.patrimonio = p.getPatrimonio();
+        r.deudas = p.getDeudas();
+        r.declaranteRenta = p.getDeclaranteRenta() ? 1 : 0;
+        bloque.push_back(r);
+
+        if (bloque.size() == BLOQUE || i + 1 == personas.size()) {
+            ok = std::fwrite(bloque.data(), sizeof(RegistroInstantanea), bloque.size(), archivo)
+                 == bloque.size();
+            bloque.clear();
+        }
+    }
+
+    // Montículo de strings al final y cabecera definitiva
+    const std::string& heap = monticulo.bytes();
+    cabecera.inicioMonticulo = cabecera.inicioRegistros
+                             + cabecera.numRegistros * sizeof(RegistroInstantanea);
+    cabecera.bytesMonticulo = heap.size();
+    if (ok && !heap.empty()) {
+        ok = std::fwrite(heap.data(), 1, heap.size(), archivo) == heap.size();
+    }
+    if (ok) {
+        ok = std::fseek(archivo, 0, SEEK_SET) == 0
+          && std::fwrite(&cabecera, sizeof(cabecera), 1, archivo) == 1;
+    }
+
+    if (std::fclose(archivo) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        std::cerr << "Error al escribir la instantánea " << ruta << "\n";
+    }
+    return ok;
+}
+
+InstantaneaMapeada::~InstantaneaMapeada() {
+    cerrar();
+}
+
+void InstantaneaMapeada::cerrar() {
+    if (mapeo) {
+        munmap(mapeo, largo);
+    }
+    mapeo = nullptr;
+    largo = 0;
+    n = 0;
+    registros = nullptr;
+    monticulo = nullptr;
+    bytesMonticulo = 0;
+}
+
+/**
+ * Implementación de abrir.
+ *
+ * POR QUÉ: Cargar una instantánea sin leer ni convertir cada registro.
+ * CÓMO: open + fstat + mmap de solo lectura; luego valida magia, versión,
+ *       tamaño de registro y que las secciones quepan en el archivo (sin restas
+ *       que den la vuelta). Los registros no se recorren: cada referencia a texto
+ *       se revisa al leerla (Vista::texto).
+ * PARA QUÉ: Carga en milisegundos sin importar el tamaño, sin leer fuera del
+ *           mapeo aunque el archivo esté corrupto o manipulado.
+ */
+bool InstantaneaMapeada::abrir(const std::string& ruta) {
+    cerrar();
+
+    int fd = open(ruta.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::perror(("Error al abrir " + ruta).c_str());
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(CabeceraInstantanea)) {
+        std::cerr << "Archivo de instantánea inválido: " << ruta << "\n";
+        close(fd);
+        return false;
+    }
+
+    size_t tamano = static_cast<size_t>(info.st_size);
+    void* direccion = mmap(nullptr, tamano, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // El mapeo sigue válido después de cerrar el descriptor
+    if (direccion == MAP_FAILED) {
+        std::perror("Error en mmap");
+        return false;
+    }
+    mapeo = direccion;
+    largo = tamano;
+
+    const char* base = static_cast<const char*>(mapeo);
+    const CabeceraInstantanea* cabecera = reinterpret_cast<const CabeceraInstantanea*>(base);
+    bool valido = std::memcmp(cabecera->magia, MAGIA, sizeof(MAGIA)) == 0
+               && cabecera->version == VERSION_INSTANTANEA
+               && cabecera->tamRegistro == sizeof(RegistroInstantanea)
+               && cabecera->inicioRegistros >= sizeof(CabeceraInstantanea)
+               && cabecera->inicioRegistros <= tamano
+               && cabecera->inicioRegistros % alignof(RegistroInstantanea) == 0
+               && cabecera->numRegistros <= (tamano - cabecera->inicioRegistros) / sizeof(RegistroInstantanea)
+               && cabecera->inicioMonticulo == cabecera->inicioRegistros
+                                               + cabecera->numRegistros * sizeof(RegistroInstantanea)
+               && cabecera->bytesMonticulo <= tamano - cabecera->inicioMonticulo;
+    if (!valido) {
+        std::cerr << "Cabecera de instantánea inválida o de otra versión: " << ruta << "\n";
+        cerrar();
+        return false;
+    }
+
+    n = cabecera->numRegistros;
+    registros = reinterpret_cast<const RegistroInstantanea*>(base + cabecera->inicioRegistros);
+    monticulo = base + cabecera->inicioMonticulo;
+    bytesMonticulo = cabecera->bytesMonticulo; // Vista::texto revisa cada referencia contra este límite
+    return true;
+}
+
+long InstantaneaMapeada::buscarPorID(std::string_view id) const {
+    return buscarPosicionPorID(*this, id);
+}
+
+void InstantaneaMapeada::Vista::mostrar() const {
+    PersonaRef(*this).mostrar();
+}
+
+void InstantaneaMapeada::Vista::mostrarResumen() const {
+    PersonaRef(*this).mostrarResumen();
+}
@@ -0,0 +1,144 @@
+#ifndef INSTANTANEA_H
+#define INSTANTANEA_H
+
+#include "persona.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Formato binario versionado de una colección de personas ("instantánea").
+ *
+ * Disposición del archivo (todo en el orden de bytes de la máquina):
+ *   [CabeceraInstantanea][n x RegistroInstantanea][montículo de strings]
+ *
+ * Los strings no se guardan dentro de los registros: cada campo de texto es un
+ * entero de 64 bits (desplazamiento << 16 | largo) que apunta al montículo.
+ * Los valores repetidos (nombres, apellidos, ciudades) se guardan una sola vez.
+ * La fecha de nacimiento no es texto: se guarda el código de Fecha.
+ */
+struct CabeceraInstantanea {
+    char magia[8];              // "PERSNAP\0"
+    uint32_t version;           // VERSION_INSTANTANEA
+    uint32_t tamRegistro;       // sizeof(RegistroInstantanea), para validar
+    uint64_t numRegistros;      // Número de personas
+    uint64_t inicioRegistros;   // Desplazamiento del primer registro
+    uint64_t inicioMonticulo;   // Desplazamiento del montículo de strings
+    uint64_t bytesMonticulo;    // Tamaño del montículo
+};
+
+struct RegistroInstantanea {
+    uint64_t nombre;            // Referencias al montículo (desplazamiento << 16 | largo)
+    uint64_t apellido;
+    uint64_t id;
+    uint64_t ciudadNacimiento;
+    uint64_t fechaNacimiento;   // Código de Fecha (desde la versión 2)
+    double ingresosAnuales;
+    double patrimonio;
+    double deudas;
+    uint8_t declaranteRenta;
+    uint8_t relleno[7];         // Mantiene el registro alineado a 8 bytes
+};
+
+const uint32_t VERSION_INSTANTANEA = 2; // 2: fecha empaquetada en lugar de texto
+
+/**
+ * Guarda una colección en un archivo de instantánea.
+ *
+ * POR QUÉ: Regenerar el conjunto en cada arranque es lento y no reproducible.
+ * CÓMO: Escribe los registros de tamaño fijo por bloques y acumula los strings
+ *       (sin repetir) en un montículo que se agrega al final; luego completa la cabecera.
+ * PARA QUÉ: Poder cargar el mismo conjunto después en milisegundos.
+ *
+ * @return true si el archivo se escribió completo.
+ */
+bool guardarInstantanea(const std::vector<Persona>& personas, const std::string& ruta);
+
+/**
+ * Instantánea cargada con mmap (vista de solo lectura, sin copias).
+ *
+ * POR QUÉ: Leer y convertir cada registro al cargar cuesta tanto como generarlo.
+ * CÓMO: Proyecta el archivo completo en memoria con mmap y valida la cabecera;
+ *       los registros y strings se leen directamente del mapeo cuando se piden
+ *       (cada referencia a texto se revisa contra el tamaño del montículo al leerla).
+ * PARA QUÉ: Carga en tiempo constante; el sistema operativo trae las páginas
+ *           a memoria solo cuando se usan.
+ */
+class InstantaneaMapeada {
+public:
+    /**
+     * Vista de una persona dentro del mapeo (no copia nada).
+     */
+    class Vista {
+    public:
+        Vista(const RegistroInstantanea* registro, const char* monticulo, uint64_t bytesMonticulo)
+            : registro(registro), monticulo(monticulo), bytesMonticulo(bytesMonticulo) {}
+
+        std::string_view nombre() const { return texto(registro->nombre); }
+        std::string_view apellido() const { return texto(registro->apellido); }
+        std::string_view id() const { return texto(registro->id); }
+        std::string_view ciudadNacimiento() const { return texto(registro->ciudadNacimiento); }
+        Fecha fechaNacimiento() const {
+            return Fecha::desdeCodigo(static_cast<uint32_t>(registro->fechaNacimiento));
+        }
+        double ingresosAnuales() const { return registro->ingresosAnuales; }
+        double patrimonio() const { return registro->patrimonio; }
+        double deudas() const { return registro->deudas; }
+        bool declaranteRenta() const { return registro->declaranteRenta != 0; }
+
+        void mostrar() const;        // Mismo formato que Persona::mostrar
+        void mostrarResumen() const; // Mismo formato que Persona::mostrarResumen
+
+    private:
+        // Una referencia fuera del montículo (archivo corrupto) se lee como texto vacío
+        std::string_view texto(uint64_t referencia) const {
+            uint64_t desde = referencia >> 16;
+            uint64_t largo = referencia & 0xFFFF;
+            if (desde > bytesMonticulo || largo > bytesMonticulo - desde) {
+                return std::string_view();
+            }
+            return std::string_view(monticulo + desde, largo);
+        }
+
+        const RegistroInstantanea* registro;
+        const char* monticulo;
+        uint64_t bytesMonticulo;
+    };
+
+    InstantaneaMapeada() = default;
+    ~InstantaneaMapeada();
+    InstantaneaMapeada(const InstantaneaMapeada&) = delete;
+    InstantaneaMapeada& operator=(const InstantaneaMapeada&) = delete;
+
+    /**
+     * Proyecta un archivo de instantánea.
+     * @return false si no se pudo abrir o la cabecera no es válida.
+     */
+    bool abrir(const std::string& ruta);
+    void cerrar();
+
+    size_t size() const { return n; }
+    bool empty() const { return n == 0; }
+    size_t bytes_mapeados() const { return largo; }
+
+    Vista operator[](size_t i) const { return Vista(registros + i, monticulo, bytesMonticulo); }
+
+    /**
+     * Busca una persona por ID recorriendo la columna de IDs.
+     *
+     * CÓMO: Compara string_view contra el montículo, sin asignar memoria.
+     * @return Posición encontrada o -1.
+     */
+    long buscarPorID(std::string_view id) const;
+
+private:
+    void* mapeo = nullptr;                         // Dirección devuelta por mmap
+    size_t largo = 0;                              // Bytes mapeados
+    size_t n = 0;                                  // Número de registros
+    const RegistroInstantanea* registros = nullptr;
+    const char* monticulo = nullptr;
+    uint64_t bytesMonticulo = 0;                   // Límite de las referencias a texto
+};
+
+#endif // INSTANTANEA_H
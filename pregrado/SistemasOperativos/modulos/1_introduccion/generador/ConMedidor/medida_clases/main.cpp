@@ -2,10 +2,34 @@
 #include <vector>
 #include <limits>
 #include <memory>
+#include <cmath>   // std::abs
+#include <cstdio>  // std::remove
+#include <algorithm> // std::sort
+#include <new>     // std::bad_alloc
 #include "persona.h"
 #include "generador.h"
+#include "indice_id.h"
+#include "indice_rango.h"
+#include "coleccion_virtual.h"
+#include "generacion_flujo.h"
+#include "instantanea.h"
+#include "csv_personas.h"
+#include "agrupacion.h"
+#include "top_k.h"
+#include "orden_radix.h"
+#include "salida_listado.h"
+#include "persona_ref.h"
+#include "contador_asignaciones.h"
+#include "mapa_bajas.h"
+#include "compactacion.h"
+#include "regeneracion.h"
+#include "consulta_fecha.h"
+#include "coleccion_mapeada.h"
 #include "monitor.h"
 
+// Opción del menú que termina el programa
+const int OPCION_SALIR = 25;
+
 /**
  * Muestra el menú principal de la aplicación.
  * 
@@ -16,39 +40,219 @@
 void mostrarMenu() {
     std::cout << "\n\n=== MENÚ PRINCIPAL ===";
     std::cout << "\n0. Crear nuevo conjunto de datos";
-    std::cout << "\n1. Mostrar resumen de todas las personas";
+    std::cout << "\n1. Mostrar resumen de personas (paginado)";
     std::cout << "\n2. Mostrar detalle completo por índice";
     std::cout << "\n3. Buscar persona por ID";
     std::cout << "\n4. Mostrar estadísticas de rendimiento";
     std::cout << "\n5. Exportar estadísticas a CSV";
-    std::cout << "\n6. Salir";
+    std::cout << "\n6. Consultar por rango financiero";
+    std::cout << "\n7. Mostrar mínimo y máximo financiero";
+    std::cout << "\n8. Generar en flujo hacia archivo (memoria constante)";
+    std::cout << "\n9. Guardar instantánea binaria";
+    std::cout << "\n10. Cargar instantánea binaria (mmap)";
+    std::cout << "\n11. Exportar personas a CSV";
+    std::cout << "\n12. Importar personas desde CSV";
+    std::cout << "\n13. Benchmark de ida y vuelta CSV";
+    std::cout << "\n14. Agrupar por ciudad o año de nacimiento";
+    std::cout << "\n15. Top-K por métrica financiera";
+    std::cout << "\n16. Ordenar por clave (radix, vista por permutación)";
+    std::cout << "\n17. Buscar en la vista ordenada (búsqueda binaria)";
+    std::cout << "\n18. Búsquedas sin copias (asignaciones por búsqueda)";
+    std::cout << "\n19. Agregar personas a la colección actual";
+    std::cout << "\n20. Actualizar campo financiero por ID";
+    std::cout << "\n21. Eliminar personas por ID (lápidas)";
+    std::cout << "\n22. Regenerar con lectores concurrentes (RCU vs cerrojo)";
+    std::cout << "\n23. Consultar por edad o fecha de nacimiento (fecha binaria)";
+    std::cout << "\n24. Colección en archivo mapeado (más grande que la RAM)";
+    std::cout << "\n" << OPCION_SALIR << ". Salir";
     std::cout << "\nSeleccione una opción: ";
 }
 
+/**
+ * Pide al usuario un campo financiero.
+ * 
+ * POR QUÉ: Varias consultas operan sobre ingresos, patrimonio o deudas.
+ * CÓMO: Muestra las tres opciones y valida la respuesta.
+ * PARA QUÉ: Reutilizar la misma pregunta en las opciones de rango.
+ * @return true si el usuario eligió un campo válido.
+ */
+bool leerCampo(CampoFinanciero& campo) {
+    int opcionCampo;
+    std::cout << "\nCampo (1. Ingresos, 2. Patrimonio, 3. Deudas): ";
+    if (!(std::cin >> opcionCampo) || opcionCampo < 1 || opcionCampo > 3) {
+        std::cout << "Campo inválido!\n";
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        return false;
+    }
+    campo = static_cast<CampoFinanciero>(opcionCampo - 1);
+    return true;
+}
+
+/**
+ * Construye el índice por ID y los índices de rango de una colección.
+ * 
+ * POR QUÉ: Toda colección nueva en memoria (generada o importada) necesita sus índices.
+ * CÓMO: Construye cada índice y mide su tiempo como diferencia sobre el cronómetro
+ *       en curso, sin reiniciarlo, para no alterar el tiempo total de la opción.
+ * PARA QUÉ: Reportar en el monitor el costo de los índices aparte del de los datos.
+ */
+void construirIndices(const std::vector<Persona>& personas, IndiceID& indiceID,
+                      IndiceRango indicesRango[3], Monitor& monitor) {
+    double tiempo_base = monitor.detener_tiempo();
+    
+    // Índice hash por ID
+    indiceID.construir(personas);
+    double tiempo_indice = monitor.detener_tiempo() - tiempo_base;
+    long memoria_indice = static_cast<long>(indiceID.memoria_bytes() / 1024);
+    
+    std::cout << "Índice por ID construido en " << tiempo_indice
+              << " ms, Memoria: " << memoria_indice << " KB\n";
+    monitor.registrar("Construir índice ID", tiempo_indice, memoria_indice);
+    
+    // Índices de rango financiero
+    size_t bytes_rango = 0;
+    for (int c = 0; c < 3; ++c) {
+        indicesRango[c].construir(personas, static_cast<CampoFinanciero>(c));
+        bytes_rango += indicesRango[c].memoria_bytes();
+    }
+    double tiempo_rango = monitor.detener_tiempo() - tiempo_base - tiempo_indice;
+    long memoria_rango = static_cast<long>(bytes_rango / 1024);
+    
+    std::cout << "Índices de rango construidos en " << tiempo_rango
+              << " ms, Memoria: " << memoria_rango << " KB\n";
+    monitor.registrar("Construir índices rango", tiempo_rango, memoria_rango);
+}
+
+/**
+ * Instala el resultado de una compactación como colección activa.
+ * 
+ * POR QUÉ: La compactación corre en otro hilo; solo el hilo del menú puede
+ *          reemplazar la colección, y lo hace entre dos opciones.
+ * CÓMO: Recoge el resultado (esperando si aún corre) y mueve la colección densa
+ *       y sus índices sobre los actuales. Las lápidas y la vista ordenada se
+ *       descartan porque las filas cambian de posición.
+ * PARA QUÉ: Que las consultas usen la colección compactada desde la opción siguiente.
+ */
+void instalarCompactacion(Compactador& compactador, std::unique_ptr<std::vector<Persona>>& personas,
+                          MapaBajas& bajas, IndiceID& indiceID, IndiceRango indicesRango[3],
+                          std::unique_ptr<VistaOrdenada>& vista, Monitor& monitor) {
+    ColeccionCompactada compactada = compactador.recoger();
+    personas = std::make_unique<std::vector<Persona>>(std::move(compactada.personas));
+    bajas.limpiar();
+    indiceID = std::move(compactada.indiceID);
+    for (int c = 0; c < 3; ++c) {
+        indicesRango[c] = std::move(compactada.indicesRango[c]);
+    }
+    vista.reset();
+    
+    std::cout << "\n[COMPACTACIÓN] " << compactada.descartadas << " filas eliminadas descartadas, "
+              << personas->size() << " personas e índices reconstruidos en " << compactada.tiempo
+              << " ms (segundo plano)\n";
+    monitor.registrar("Compactar (segundo plano)", compactada.tiempo, 0);
+}
+
+/**
+ * Carga una instantánea con mmap y registra el tiempo en el monitor.
+ * 
+ * POR QUÉ: Se usa desde el menú y al arrancar con un archivo como argumento.
+ * CÓMO: Abre el archivo con InstantaneaMapeada y mide la operación.
+ * PARA QUÉ: Reutilizar un conjunto guardado sin regenerarlo.
+ * @return La instantánea abierta, o nullptr si hubo un error.
+ */
+std::unique_ptr<InstantaneaMapeada> cargarInstantanea(const std::string& ruta, Monitor& monitor) {
+    monitor.iniciar_tiempo();
+    long memoria_inicio = monitor.obtener_memoria();
+    
+    auto instantanea = std::make_unique<InstantaneaMapeada>();
+    if (!instantanea->abrir(ruta)) {
+        return nullptr;
+    }
+    
+    double tiempo_carga = monitor.detener_tiempo();
+    long memoria_carga = monitor.obtener_memoria() - memoria_inicio;
+    std::cout << "Instantánea " << ruta << " cargada: " << instantanea->size()
+              << " personas (" << instantanea->bytes_mapeados() / 1024 << " KB mapeados) en "
+              << tiempo_carga << " ms\n";
+    monitor.registrar("Cargar instantánea", tiempo_carga, memoria_carga);
+    return instantanea;
+}
+
 /**
  * Punto de entrada principal del programa.
  * 
  * POR QUÉ: Iniciar la aplicación y manejar el flujo principal.
  * CÓMO: Mediante un bucle que muestra el menú y procesa la opción seleccionada.
+ *       Si se pasa un archivo como argumento, se carga como instantánea al arrancar.
  * PARA QUÉ: Ejecutar las funcionalidades del sistema.
  */
-int main() {
+int main(int argc, char* argv[]) {
     srand(time(nullptr)); // Semilla para generación aleatoria
     
     // Puntero inteligente para gestionar la colección de personas
     // POR QUÉ: Evitar fugas de memoria y garantizar liberación automática.
     std::unique_ptr<std::vector<Persona>> personas = nullptr;
     
+    // Índice hash cédula -> fila, reconstruido con cada nueva colección
+    IndiceID indiceID;
+    
+    // Índices ordenados (Eytzinger) sobre ingresos, patrimonio y deudas
+    IndiceRango indicesRango[3];
+    
+    // Colección virtual: registros calculados bajo demanda (alternativa a 'personas')
+    std::unique_ptr<ColeccionVirtual> coleccionVirtual = nullptr;
+    
+    // Instantánea proyectada con mmap (alternativa de solo lectura a 'personas')
+    std::unique_ptr<InstantaneaMapeada> instantanea = nullptr;
+    
+    // Colección en un archivo mapeado, independiente de las demás (opción 24)
+    std::unique_ptr<ColeccionMapeada> mapeada = nullptr;
+    
+    // Vista ordenada de 'personas' (permutación de filas); se descarta al cambiar la colección
+    std::unique_ptr<VistaOrdenada> vista = nullptr;
+    
+    // Lápidas de 'personas': filas eliminadas que los recorridos omiten hasta compactar
+    MapaBajas bajas;
+    
+    // Compactación de 'personas' e índices en segundo plano
+    Compactador compactador;
+    
     Monitor monitor; // Monitor para medir rendimiento
     
+    // ./programa datos.snap: arranca directamente con una instantánea guardada
+    if (argc > 1) {
+        instantanea = cargarInstantanea(argv[1], monitor);
+    }
+    
+    // Formato numérico por defecto de std::cout, para restaurarlo después de cada opción
+    const std::ios_base::fmtflags formatoCout = std::cout.flags();
+    const std::streamsize precisionCout = std::cout.precision();
+    
     int opcion;
     do {
+        // Una compactación terminada se instala entre dos opciones
+        if (compactador.terminada()) {
+            instalarCompactacion(compactador, personas, bajas, indiceID, indicesRango, vista, monitor);
+        }
+        
         mostrarMenu();
         std::cin >> opcion;
         
+        // Mientras se compacta, la colección solo se lee: las opciones que la modifican
+        // o que la necesitan densa (guardar, exportar) esperan e instalan el resultado
+        bool modifica = opcion == 0 || opcion == 10 || opcion == 12 || (opcion >= 19 && opcion <= 21);
+        bool requiereDensa = (opcion == 9 || opcion == 11 || opcion == 13) && personas && !bajas.vacio();
+        if (requiereDensa && !compactador.enCurso()) {
+            compactador.iniciar(*personas, bajas);
+        }
+        if (compactador.enCurso() && (modifica || requiereDensa)) {
+            std::cout << "\nEsperando la compactación en curso...";
+            instalarCompactacion(compactador, personas, bajas, indiceID, indicesRango, vista, monitor);
+        }
+        
         // Variables locales para uso en los casos
         size_t tam = 0;
-        int indice;
+        long long indice;
         std::string idBusqueda;
         
         // Iniciar medición de tiempo y memoria para la operación actual
@@ -57,7 +261,7 @@ int main() {
         
         switch(opcion) {
             case 0: { // Crear nuevo conjunto de datos
-                int n;
+                long long n;
                 std::cout << "\nIngrese el número de personas a generar: ";
                 std::cin >> n;
                 
@@ -66,12 +270,79 @@ int main() {
                     break;
                 }
                 
-                // Generar el nuevo conjunto de personas
-                auto nuevasPersonas = generarColeccion(n);
+                int modo = 0;
+                for (;;) {
+                    std::cout << "Modo (1. Secuencial, 2. Paralelo determinista, 3. Virtual bajo demanda): ";
+                    if (std::cin >> modo && modo >= 1 && modo <= 3) {
+                        break;
+                    }
+                    if (std::cin.eof()) {
+                        modo = 0;
+                        break;
+                    }
+                    std::cout << "Modo inválido!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                }
+                if (modo == 0) {
+                    break; // Fin de la entrada
+                }
+                
+                unsigned long long semilla = 0;
+                unsigned hilos = 0;
+                if (modo == 2 || modo == 3) {
+                    std::cout << "Semilla: ";
+                    std::cin >> semilla;
+                }
+                if (modo == 2) {
+                    std::cout << "Hilos (0 = todos los núcleos): ";
+                    std::cin >> hilos;
+                }
+                
+                if (modo == 3) {
+                    // Colección virtual: no se genera nada por adelantado
+                    personas.reset();
+                    vista.reset();
+                    bajas.limpiar();
+                    instantanea.reset();
+                    indiceID.limpiar();
+                    coleccionVirtual = std::make_unique<ColeccionVirtual>(n, semilla);
+                    
+                    double tiempo_virtual = monitor.detener_tiempo();
+                    long memoria_virtual = monitor.obtener_memoria() - memoria_inicio;
+                    std::cout << "Colección virtual de " << n << " personas lista (semilla "
+                              << semilla << ")\n";
+                    monitor.registrar("Crear datos (virtual)", tiempo_virtual, memoria_virtual);
+                    break;
+                }
+                if (n > std::numeric_limits<int>::max()) {
+                    std::cout << "Error: Para más de " << std::numeric_limits<int>::max()
+                              << " personas use el modo virtual o la opción 24\n";
+                    break;
+                }
+                coleccionVirtual.reset();
+                instantanea.reset();
+                
+                // Generar el nuevo conjunto de personas (sin contar el tiempo de captura)
+                monitor.iniciar_tiempo();
+                std::vector<Persona> nuevasPersonas;
+                try {
+                    nuevasPersonas = (modo == 2)
+                        ? generarColeccionParalela(static_cast<int>(n), semilla, hilos)
+                        : generarColeccion(static_cast<int>(n));
+                } catch (const std::bad_alloc&) {
+                    // 'personas' no se tocó: sigue disponible con sus índices
+                    std::cout << "Error: " << n << " personas no caben en memoria ("
+                              << n * sizeof(Persona) / (1024 * 1024) << " MB solo en objetos Persona). "
+                              << "Use la opción 24 (archivo mapeado)\n";
+                    break;
+                }
                 tam = nuevasPersonas.size();
                 
                 // Mover el conjunto al puntero inteligente (propiedad única)
                 personas = std::make_unique<std::vector<Persona>>(std::move(nuevasPersonas));
+                vista.reset();
+                bajas.limpiar();
                 
                 // Medir tiempo y memoria usada
                 double tiempo_gen = monitor.detener_tiempo();
@@ -79,33 +350,141 @@ int main() {
                 
                 std::cout << "Generadas " << tam << " personas en " 
                           << tiempo_gen << " ms, Memoria: " << memoria_gen << " KB\n";
+                std::cout << "Diccionario de textos internados: " << Diccionario::global().size()
+                          << " textos, " << Diccionario::global().memoria_bytes() / 1024 << " KB\n";
                 
                 // Registrar la operación
                 monitor.registrar("Crear datos", tiempo_gen, memoria_gen);
+                
+                // Construir los índices (se miden aparte de la generación)
+                construirIndices(*personas, indiceID, indicesRango, monitor);
                 break;
             }
                 
-            case 1: { // Mostrar resumen de todas las personas
-                if (!personas || personas->empty()) {
+            case 1: { // Mostrar resumen de las personas (paginado)
+                uint64_t total = instantanea ? instantanea->size()
+                               : coleccionVirtual ? coleccionVirtual->size()
+                               : personas ? (vista ? vista->size() : personas->size()) : 0;
+                if (total == 0) {
                     std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
                     break;
                 }
                 
-                tam = personas->size();
-                std::cout << "\n=== RESUMEN DE PERSONAS (" << tam << ") ===\n";
-                for(size_t i = 0; i < tam; ++i) {
-                    std::cout << i << ". ";
-                    (*personas)[i].mostrarResumen();
-                    std::cout << "\n";
+                uint64_t desde = 0, cantidad = 0;
+                int salida;
+                std::cout << "\nDesde la posición (0-" << total - 1 << "): ";
+                std::cin >> desde;
+                std::cout << "Cantidad (0 = todas): ";
+                std::cin >> cantidad;
+                std::cout << "Salida (1. Búfer con write(2), 2. operator<< de referencia): ";
+                std::cin >> salida;
+                if (desde >= total) {
+                    std::cout << "Posición fuera de rango!\n";
+                    break;
+                }
+                uint64_t hasta = (cantidad == 0 || cantidad > total - desde) ? total : desde + cantidad;
+                
+                const char* origen = instantanea ? "instantánea" : coleccionVirtual ? "virtual" : "memoria";
+                std::cout << "\n=== RESUMEN DE PERSONAS (" << desde << "-" << hasta - 1 << " de " << total
+                          << ", " << origen;
+                if (personas && vista) {
+                    // Orden de la vista activa: se muestra la fila original de cada persona
+                    std::cout << ", ordenadas por " << nombreClave(vista->clave());
+                } else if (personas && !bajas.vacio()) {
+                    std::cout << ", se omiten las eliminadas";
+                }
+                std::cout << ") ===\n";
+                
+                monitor.iniciar_tiempo();
+                unsigned long long bytes = 0;
+                uint64_t mostradas = 0;
+                if (salida == 2) {
+                    // Referencia: mostrarResumen con operator<< registro a registro
+                    for (uint64_t pos = desde; pos < hasta; ++pos) {
+                        uint64_t fila = (personas && vista) ? (*vista)[pos] : pos;
+                        if (bajas.eliminada(fila)) {
+                            continue;
+                        }
+                        ++mostradas;
+                        std::cout << fila << ". ";
+                        if (instantanea) {
+                            (*instantanea)[fila].mostrarResumen();
+                        } else if (coleccionVirtual) {
+                            (*coleccionVirtual)[fila].mostrarResumen();
+                        } else {
+                            (*personas)[fila].mostrarResumen();
+                        }
+                        std::cout << "\n";
+                    }
+                    std::cout.flush();
+                } else {
+                    EscritorListado escritor;
+                    for (uint64_t pos = desde; pos < hasta; ++pos) {
+                        uint64_t fila = (personas && vista) ? (*vista)[pos] : pos;
+                        if (bajas.eliminada(fila)) {
+                            continue;
+                        }
+                        ++mostradas;
+                        if (instantanea) {
+                            escritor.agregarResumen(fila, (*instantanea)[fila]);
+                        } else if (coleccionVirtual) {
+                            escritor.agregarResumen(fila, (*coleccionVirtual)[fila]);
+                        } else {
+                            escritor.agregarResumen(fila, (*personas)[fila]);
+                        }
+                    }
+                    escritor.vaciar();
+                    bytes = escritor.bytes();
                 }
                 
                 double tiempo_mostrar = monitor.detener_tiempo();
                 long memoria_mostrar = monitor.obtener_memoria() - memoria_inicio;
-                monitor.registrar("Mostrar resumen", tiempo_mostrar, memoria_mostrar);
+                monitor.registrar_flujo(salida == 2 ? "Mostrar resumen (operator<<)" : "Mostrar resumen (búfer + write)",
+                                        tiempo_mostrar, memoria_mostrar, mostradas, bytes);
                 break;
             }
                 
             case 2: { // Mostrar detalle por índice
+                if (instantanea) {
+                    tam = instantanea->size();
+                    std::cout << "\nIngrese el índice (0-" << tam - 1 << "): ";
+                    if (std::cin >> indice) {
+                        if (indice >= 0 && static_cast<size_t>(indice) < tam) {
+                            (*instantanea)[indice].mostrar();
+                        } else {
+                            std::cout << "Índice fuera de rango!\n";
+                        }
+                    } else {
+                        std::cout << "Entrada inválida!\n";
+                        std::cin.clear();
+                        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    }
+                    
+                    double tiempo_detalle = monitor.detener_tiempo();
+                    long memoria_detalle = monitor.obtener_memoria() - memoria_inicio;
+                    monitor.registrar("Mostrar detalle (instantánea)", tiempo_detalle, memoria_detalle);
+                    break;
+                }
+                if (coleccionVirtual) {
+                    uint64_t total = coleccionVirtual->size();
+                    std::cout << "\nIngrese el índice (0-" << total - 1 << "): ";
+                    if (std::cin >> indice) {
+                        if (indice >= 0 && static_cast<uint64_t>(indice) < total) {
+                            (*coleccionVirtual)[indice].mostrar();
+                        } else {
+                            std::cout << "Índice fuera de rango!\n";
+                        }
+                    } else {
+                        std::cout << "Entrada inválida!\n";
+                        std::cin.clear();
+                        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    }
+                    
+                    double tiempo_detalle = monitor.detener_tiempo();
+                    long memoria_detalle = monitor.obtener_memoria() - memoria_inicio;
+                    monitor.registrar("Mostrar detalle (virtual)", tiempo_detalle, memoria_detalle);
+                    break;
+                }
                 if (!personas || personas->empty()) {
                     std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
                     break;
@@ -115,7 +494,11 @@ int main() {
                 std::cout << "\nIngrese el índice (0-" << tam-1 << "): ";
                 if(std::cin >> indice) {
                     if(indice >= 0 && static_cast<size_t>(indice) < tam) {
-                        (*personas)[indice].mostrar();
+                        if (bajas.eliminada(indice)) {
+                            std::cout << "La persona de la fila " << indice << " fue eliminada\n";
+                        } else {
+                            (*personas)[indice].mostrar();
+                        }
                     } else {
                         std::cout << "Índice fuera de rango!\n";
                     }
@@ -132,6 +515,39 @@ int main() {
             }
                 
             case 3: { // Buscar por ID
+                if (instantanea) {
+                    std::cout << "\nIngrese el ID a buscar: ";
+                    std::cin >> idBusqueda;
+                    
+                    long fila = instantanea->buscarPorID(idBusqueda);
+                    if (fila >= 0) {
+                        (*instantanea)[fila].mostrar();
+                    } else {
+                        std::cout << "No se encontró persona con ID " << idBusqueda << "\n";
+                    }
+                    
+                    double tiempo_busqueda = monitor.detener_tiempo();
+                    long memoria_busqueda = monitor.obtener_memoria() - memoria_inicio;
+                    monitor.registrar("Buscar por ID (instantánea)", tiempo_busqueda, memoria_busqueda);
+                    break;
+                }
+                if (coleccionVirtual) {
+                    std::cout << "\nIngrese el ID a buscar: ";
+                    std::cin >> idBusqueda;
+                    
+                    // El ID secuencial se traduce directamente a la posición
+                    uint64_t posicion;
+                    if (coleccionVirtual->posicionDeID(idBusqueda, posicion)) {
+                        (*coleccionVirtual)[posicion].mostrar();
+                    } else {
+                        std::cout << "No se encontró persona con ID " << idBusqueda << "\n";
+                    }
+                    
+                    double tiempo_busqueda = monitor.detener_tiempo();
+                    long memoria_busqueda = monitor.obtener_memoria() - memoria_inicio;
+                    monitor.registrar("Buscar por ID (virtual)", tiempo_busqueda, memoria_busqueda);
+                    break;
+                }
                 if (!personas || personas->empty()) {
                     std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
                     break;
@@ -140,7 +556,7 @@ int main() {
                 std::cout << "\nIngrese el ID a buscar: ";
                 std::cin >> idBusqueda;
                 
-                if(const Persona* encontrada = buscarPorID(*personas, idBusqueda)) {
+                if(const Persona* encontrada = buscarPorID(*personas, indiceID, idBusqueda)) {
                     encontrada->mostrar();
                 } else {
                     std::cout << "No se encontró persona con ID " << idBusqueda << "\n";
@@ -160,7 +576,1044 @@ int main() {
                 monitor.exportar_csv();
                 break;
                 
-            case 6: // Salir
+            case 6: { // Consultar por rango financiero
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                CampoFinanciero campo;
+                if (!leerCampo(campo)) {
+                    break;
+                }
+                double minimo, maximo;
+                std::cout << "Valor mínimo: ";
+                std::cin >> minimo;
+                std::cout << "Valor máximo: ";
+                std::cin >> maximo;
+                
+                const IndiceRango& indiceRango = indicesRango[static_cast<int>(campo)];
+                size_t total = indiceRango.contar(minimo, maximo);
+                std::cout << "\n" << nombreCampo(campo) << " en [" << std::fixed
+                          << std::setprecision(2) << minimo << ", " << maximo << "]: "
+                          << total << " personas\n";
+                
+                // Recorrido ordenado de las primeras coincidencias
+                const size_t LIMITE_LISTADO = 10;
+                std::vector<uint32_t> filas;
+                indiceRango.filas(minimo, maximo, filas, LIMITE_LISTADO);
+                for (uint32_t fila : filas) {
+                    std::cout << fila << ". ";
+                    (*personas)[fila].mostrarResumen();
+                    std::cout << " | " << nombreCampo(campo) << ": $"
+                              << valorCampo((*personas)[fila], campo) << "\n";
+                }
+                if (total > filas.size()) {
+                    std::cout << "... (" << total - filas.size() << " más)\n";
+                }
+                
+                double tiempo_rango = monitor.detener_tiempo();
+                long memoria_rango = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Consulta por rango", tiempo_rango, memoria_rango);
+                break;
+            }
+                
+            case 7: { // Mínimo y máximo financiero
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                CampoFinanciero campo;
+                if (!leerCampo(campo)) {
+                    break;
+                }
+                const IndiceRango& indiceRango = indicesRango[static_cast<int>(campo)];
+                uint32_t filaMin, filaMax;
+                if (indiceRango.minimo(filaMin) && indiceRango.maximo(filaMax)) {
+                    std::cout << "\n=== MÍNIMO (" << nombreCampo(campo) << ") ===\n";
+                    (*personas)[filaMin].mostrar();
+                    std::cout << "\n=== MÁXIMO (" << nombreCampo(campo) << ") ===\n";
+                    (*personas)[filaMax].mostrar();
+                }
+                
+                double tiempo_extremos = monitor.detener_tiempo();
+                long memoria_extremos = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Mínimo/máximo", tiempo_extremos, memoria_extremos);
+                break;
+            }
+                
+            case 8: { // Generación en flujo hacia un sumidero
+                unsigned long long n, semilla;
+                int tipo;
+                std::cout << "\nIngrese el número de personas a generar: ";
+                std::cin >> n;
+                std::cout << "Semilla: ";
+                std::cin >> semilla;
+                std::cout << "Destino (1. Binario, 2. CSV, 3. Nulo): ";
+                std::cin >> tipo;
+                
+                std::unique_ptr<Sumidero> sumidero;
+                if (tipo == 1 || tipo == 2) {
+                    std::string ruta;
+                    std::cout << "Archivo de salida: ";
+                    std::cin >> ruta;
+                    auto archivo = std::make_unique<SumideroArchivo>(ruta, tipo == 1
+                        ? SumideroArchivo::Formato::Binario
+                        : SumideroArchivo::Formato::CSV);
+                    if (!archivo->abierto()) {
+                        break;
+                    }
+                    sumidero = std::move(archivo);
+                } else if (tipo == 3) {
+                    sumidero = std::make_unique<SumideroNulo>();
+                } else {
+                    std::cout << "Destino inválido!\n";
+                    break;
+                }
+                
+                // Bloques de 64K personas: la memoria no depende de n
+                const size_t TAM_BLOQUE = 1 << 16;
+                monitor.iniciar_tiempo();
+                ResultadoFlujo resultado = generarColeccionFlujo(n, semilla, TAM_BLOQUE, *sumidero);
+                std::string destino = sumidero->nombre();
+                sumidero.reset(); // Cierra el archivo (incluido en el tiempo medido)
+                
+                double tiempo_flujo = monitor.detener_tiempo();
+                long memoria_flujo = monitor.obtener_memoria() - memoria_inicio;
+                
+                if (!resultado.ok) {
+                    std::cout << "Error de escritura en " << destino << "\n";
+                }
+                std::cout << "Generadas " << resultado.registros << " personas hacia "
+                          << destino << " (" << resultado.bytes / (1024 * 1024) << " MB) en "
+                          << tiempo_flujo << " ms\n";
+                monitor.registrar_flujo("Flujo " + destino, tiempo_flujo, memoria_flujo,
+                                        resultado.registros, resultado.bytes);
+                break;
+            }
+                
+            case 9: { // Guardar instantánea binaria
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos en memoria para guardar. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::string ruta;
+                std::cout << "\nArchivo de instantánea: ";
+                std::cin >> ruta;
+                
+                monitor.iniciar_tiempo();
+                if (guardarInstantanea(*personas, ruta)) {
+                    double tiempo_guardar = monitor.detener_tiempo();
+                    long memoria_guardar = monitor.obtener_memoria() - memoria_inicio;
+                    std::cout << "Guardadas " << personas->size() << " personas en " << ruta
+                              << " (" << tiempo_guardar << " ms)\n";
+                    monitor.registrar("Guardar instantánea", tiempo_guardar, memoria_guardar);
+                }
+                break;
+            }
+                
+            case 10: { // Cargar instantánea binaria con mmap
+                std::string ruta;
+                std::cout << "\nArchivo de instantánea: ";
+                std::cin >> ruta;
+                
+                auto cargada = cargarInstantanea(ruta, monitor);
+                if (cargada) {
+                    // La instantánea reemplaza a la colección activa
+                    personas.reset();
+                    vista.reset();
+                    bajas.limpiar();
+                    coleccionVirtual.reset();
+                    indiceID.limpiar();
+                    instantanea = std::move(cargada);
+                }
+                break;
+            }
+                
+            case 11: { // Exportar personas a CSV
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos en memoria para exportar. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::string ruta;
+                std::cout << "\nArchivo CSV de salida: ";
+                std::cin >> ruta;
+                
+                monitor.iniciar_tiempo();
+                unsigned long long bytes = exportarPersonasCSV(*personas, ruta);
+                double tiempo_exportar = monitor.detener_tiempo();
+                long memoria_exportar = monitor.obtener_memoria() - memoria_inicio;
+                if (bytes > 0) {
+                    std::cout << "Exportadas " << personas->size() << " personas a " << ruta
+                              << " en " << tiempo_exportar << " ms\n";
+                    monitor.registrar_flujo("Exportar CSV", tiempo_exportar, memoria_exportar,
+                                            personas->size(), bytes);
+                }
+                break;
+            }
+                
+            case 12: { // Importar personas desde CSV
+                std::string ruta;
+                unsigned hilos;
+                std::cout << "\nArchivo CSV de entrada: ";
+                std::cin >> ruta;
+                std::cout << "Hilos (0 = todos los núcleos): ";
+                std::cin >> hilos;
+                
+                monitor.iniciar_tiempo();
+                std::vector<Persona> importadas;
+                unsigned long long bytes = 0;
+                if (!importarPersonasCSV(ruta, importadas, hilos, bytes)) {
+                    break;
+                }
+                double tiempo_importar = monitor.detener_tiempo();
+                long memoria_importar = monitor.obtener_memoria() - memoria_inicio;
+                std::cout << "Importadas " << importadas.size() << " personas de " << ruta
+                          << " en " << tiempo_importar << " ms\n";
+                monitor.registrar_flujo("Importar CSV", tiempo_importar, memoria_importar,
+                                        importadas.size(), bytes);
+                
+                // La colección importada reemplaza a la activa
+                coleccionVirtual.reset();
+                instantanea.reset();
+                personas = std::make_unique<std::vector<Persona>>(std::move(importadas));
+                vista.reset();
+                bajas.limpiar();
+                construirIndices(*personas, indiceID, indicesRango, monitor);
+                break;
+            }
+                
+            case 13: { // Benchmark de ida y vuelta CSV
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos en memoria. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                const std::string ruta = "ida_vuelta.csv";
+                const std::string rutaFlujo = "ida_vuelta_ostream.csv";
+                const size_t n = personas->size();
+                
+                // 1) Exportación de referencia con operator<<
+                monitor.iniciar_tiempo();
+                unsigned long long bytesFlujo = exportarPersonasCSVFlujo(*personas, rutaFlujo);
+                double tiempo_flujo = monitor.detener_tiempo();
+                monitor.registrar_flujo("CSV exportar (ostream)", tiempo_flujo, 0, n, bytesFlujo);
+                std::remove(rutaFlujo.c_str());
+                
+                // 2) Exportación con to_chars y búfer grande
+                monitor.iniciar_tiempo();
+                unsigned long long bytes = exportarPersonasCSV(*personas, ruta);
+                double tiempo_exportar = monitor.detener_tiempo();
+                monitor.registrar_flujo("CSV exportar (to_chars)", tiempo_exportar, 0, n, bytes);
+                
+                // 3) Importación paralela
+                monitor.iniciar_tiempo();
+                std::vector<Persona> leidas;
+                unsigned long long bytesLeidos = 0;
+                bool ok = bytes > 0 && importarPersonasCSV(ruta, leidas, 0, bytesLeidos);
+                double tiempo_importar = monitor.detener_tiempo();
+                monitor.registrar_flujo("CSV importar (paralelo)", tiempo_importar, 0, n, bytesLeidos);
+                std::remove(ruta.c_str());
+                
+                // 4) Verificación: textos idénticos y montos con error < 1 centavo
+                size_t diferencias = 0;
+                if (ok && leidas.size() == n) {
+                    for (size_t i = 0; i < n; ++i) {
+                        const Persona& a = (*personas)[i];
+                        const Persona& b = leidas[i];
+                        if (a.getId() != b.getId() || a.getNombre() != b.getNombre()
+                            || a.getApellido() != b.getApellido()
+                            || a.getCiudadNacimiento() != b.getCiudadNacimiento()
+                            || a.getFechaNacimiento() != b.getFechaNacimiento()
+                            || std::abs(a.getIngresosAnuales() - b.getIngresosAnuales()) > 0.01
+                            || std::abs(a.getPatrimonio() - b.getPatrimonio()) > 0.01
+                            || std::abs(a.getDeudas() - b.getDeudas()) > 0.01
+                            || a.getDeclaranteRenta() != b.getDeclaranteRenta()) {
+                            ++diferencias;
+                        }
+                    }
+                } else {
+                    diferencias = n;
+                }
+                
+                std::cout << "\n=== IDA Y VUELTA CSV (" << n << " personas, "
+                          << bytes / (1024 * 1024) << " MB) ===\n"
+                          << "Exportar (ostream):  " << tiempo_flujo << " ms\n"
+                          << "Exportar (to_chars): " << tiempo_exportar << " ms\n"
+                          << "Importar (paralelo): " << tiempo_importar << " ms\n"
+                          << "Registros distintos tras la ida y vuelta: " << diferencias << "\n";
+                break;
+            }
+                
+            case 14: { // Agrupar por ciudad o año de nacimiento
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos en memoria. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                int opcionCriterio;
+                unsigned hilos = 0;
+                std::cout << "\nAgrupar por (1. Ciudad, 2. Año de nacimiento): ";
+                std::cin >> opcionCriterio;
+                if (opcionCriterio != 1 && opcionCriterio != 2) {
+                    std::cout << "Criterio inválido!\n";
+                    break;
+                }
+                std::cout << "Hilos (0 = todos los núcleos): ";
+                std::cin >> hilos;
+                
+                CriterioGrupo criterio = (opcionCriterio == 1) ? CriterioGrupo::Ciudad
+                                                               : CriterioGrupo::AnioNacimiento;
+                ResultadoAgrupacion resultado = agruparPersonas(*personas, criterio, hilos, &bajas);
+                
+                std::cout << "\n=== AGRUPACIÓN POR " << (opcionCriterio == 1 ? "CIUDAD" : "AÑO DE NACIMIENTO")
+                          << " (" << resultado.grupos.size() << " grupos, " << resultado.hilos << " hilos) ===\n";
+                std::cout << std::fixed << std::setprecision(2);
+                for (const auto& g : resultado.grupos) {
+                    std::cout << g.clave << ": " << g.personas << " personas"
+                              << " | Ingreso promedio: $" << g.promedioIngresos()
+                              << " | Declarantes: " << 100.0 * g.proporcionDeclarantes() << "%\n";
+                }
+                
+                // Tiempo de cada fase: recorrido (con su tasa), fusión y armado del resultado
+                const size_t n = personas->size();
+                monitor.registrar_flujo("Agrupar: recorrido paralelo", resultado.tiempoRecorrido, 0,
+                                        n, n * sizeof(Persona));
+                monitor.registrar("Agrupar: fusión de parciales", resultado.tiempoFusion, 0);
+                monitor.registrar("Agrupar: armar resultado", resultado.tiempoResultado, 0);
+                std::cout << "Fases: recorrido " << resultado.tiempoRecorrido << " ms, fusión "
+                          << resultado.tiempoFusion << " ms, resultado " << resultado.tiempoResultado << " ms\n";
+                break;
+            }
+                
+            case 15: { // Top-K por métrica financiera
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos en memoria. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                size_t k;
+                int opcionMetrica;
+                unsigned hilos = 0;
+                char comparar;
+                std::cout << "\nK (número de personas): ";
+                std::cin >> k;
+                std::cout << "Métrica (1. Patrimonio neto, 2. Ingresos, 3. Patrimonio, 4. Deudas, "
+                             "5. Razón deuda/ingreso): ";
+                std::cin >> opcionMetrica;
+                if (k == 0 || opcionMetrica < 1 || opcionMetrica > 5) {
+                    std::cout << "K o métrica inválida!\n";
+                    break;
+                }
+                std::cout << "Hilos (0 = todos los núcleos): ";
+                std::cin >> hilos;
+                std::cout << "¿Comparar con std::partial_sort? (s/n): ";
+                std::cin >> comparar;
+                MetricaTopK metrica = static_cast<MetricaTopK>(opcionMetrica - 1);
+                const size_t n = personas->size();
+                
+                monitor.iniciar_tiempo();
+                std::vector<EntradaTopK> mejores = topK(*personas, k, metrica, hilos, &bajas);
+                double tiempo_topk = monitor.detener_tiempo();
+                monitor.registrar_flujo("Top-K (montículos por hilo)", tiempo_topk, 0, n, n * sizeof(Persona));
+                
+                std::cout << "\n=== TOP " << mejores.size() << " POR " << nombreMetrica(metrica) << " ===\n";
+                for (size_t pos = 0; pos < mejores.size(); ++pos) {
+                    std::cout << pos + 1 << ". ";
+                    (*personas)[mejores[pos].fila].mostrarResumen();
+                    std::cout << " | " << nombreMetrica(metrica) << ": " << std::fixed
+                              << std::setprecision(metrica == MetricaTopK::RazonDeudaIngreso ? 4 : 2)
+                              << mejores[pos].valor << "\n";
+                }
+                std::cout << "Top-K: " << std::setprecision(2) << tiempo_topk << " ms\n";
+                
+                if (comparar == 's' || comparar == 'S') {
+                    monitor.iniciar_tiempo();
+                    std::vector<EntradaTopK> referencia = topKOrdenamientoParcial(*personas, k, metrica, &bajas);
+                    double tiempo_parcial = monitor.detener_tiempo();
+                    monitor.registrar_flujo("Top-K (std::partial_sort)", tiempo_parcial, 0, n, n * sizeof(Persona));
+                    
+                    bool iguales = referencia.size() == mejores.size();
+                    for (size_t pos = 0; iguales && pos < referencia.size(); ++pos) {
+                        iguales = referencia[pos].fila == mejores[pos].fila;
+                    }
+                    std::cout << "std::partial_sort: " << tiempo_parcial << " ms ("
+                              << (tiempo_topk > 0 ? tiempo_parcial / tiempo_topk : 0) << "x)"
+                              << (iguales ? " | Mismo resultado\n" : " | ERROR: resultados distintos\n");
+                }
+                break;
+            }
+                
+            case 16: { // Ordenar por clave con radix sort (vista por permutación)
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos en memoria. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                int opcionClave;
+                unsigned hilos = 0;
+                char comparar;
+                std::cout << "\nClave (1. Cédula, 2. Ingresos, 3. Patrimonio, 4. Ciudad, 0. Quitar orden): ";
+                std::cin >> opcionClave;
+                if (opcionClave == 0) {
+                    vista.reset();
+                    std::cout << "Orden quitado: el listado vuelve al orden de la colección\n";
+                    break;
+                }
+                if (opcionClave < 1 || opcionClave > 4) {
+                    std::cout << "Clave inválida!\n";
+                    break;
+                }
+                std::cout << "Hilos (0 = todos los núcleos): ";
+                std::cin >> hilos;
+                std::cout << "¿Comparar con std::sort sobre una copia de los registros? (s/n): ";
+                std::cin >> comparar;
+                ClaveOrden clave = static_cast<ClaveOrden>(opcionClave - 1);
+                const size_t n = personas->size();
+                
+                monitor.iniciar_tiempo();
+                auto nueva = std::make_unique<VistaOrdenada>();
+                nueva->construir(*personas, clave, hilos, &bajas);
+                double tiempo_radix = monitor.detener_tiempo();
+                monitor.registrar_flujo("Ordenar (radix, permutación)", tiempo_radix, nueva->memoria_bytes() / 1024,
+                                        n, n * (sizeof(uint64_t) + sizeof(uint32_t)));
+                
+                std::cout << "Vista por " << nombreClave(clave) << ": " << nueva->size() << " filas, "
+                          << nueva->pasadas() << " pasadas de 8 bits, " << std::fixed << std::setprecision(2)
+                          << tiempo_radix << " ms, " << nueva->memoria_bytes() / 1024 << " KB\n";
+                
+                if (comparar == 's' || comparar == 'S') {
+                    // La copia (solo filas vivas) se hace fuera del cronómetro: solo se mide la ordenación
+                    std::vector<Persona> copia;
+                    copia.reserve(nueva->size());
+                    for (size_t i = 0; i < n; ++i) {
+                        if (!bajas.eliminada(i)) {
+                            copia.push_back((*personas)[i]);
+                        }
+                    }
+                    const VistaOrdenada& orden = *nueva;
+                    monitor.iniciar_tiempo();
+                    std::sort(copia.begin(), copia.end(), [&](const Persona& a, const Persona& b) {
+                        return orden.claveDe(a) < orden.claveDe(b);
+                    });
+                    double tiempo_sort = monitor.detener_tiempo();
+                    monitor.registrar_flujo("Ordenar (std::sort de registros)", tiempo_sort, 0,
+                                            n, n * sizeof(Persona));
+                    
+                    // Misma secuencia de claves (el radix además es estable)
+                    bool iguales = copia.size() == orden.size();
+                    for (size_t pos = 0; iguales && pos < orden.size(); ++pos) {
+                        iguales = orden.claveDe((*personas)[orden[pos]]) == orden.claveDe(copia[pos]);
+                    }
+                    std::cout << "std::sort: " << tiempo_sort << " ms ("
+                              << (tiempo_radix > 0 ? tiempo_sort / tiempo_radix : 0) << "x)"
+                              << (iguales ? " | Mismo orden\n" : " | ERROR: órdenes distintos\n");
+                }
+                vista = std::move(nueva);
+                std::cout << "La opción 1 lista ahora en este orden\n";
+                break;
+            }
+                
+            case 17: { // Buscar en la vista ordenada
+                if (!personas || !vista) {
+                    std::cout << "\nNo hay vista ordenada. Use opción 16 primero.\n";
+                    break;
+                }
+                
+                uint64_t minimo = 0, maximo = 0;
+                if (vista->clave() == ClaveOrden::Cedula) {
+                    std::cout << "\nID a buscar: ";
+                    std::cin >> idBusqueda;
+                    minimo = maximo = VistaOrdenada::claveCedula(idBusqueda);
+                } else if (vista->clave() == ClaveOrden::Ciudad) {
+                    std::string ciudad;
+                    std::cout << "\nCiudad a buscar: ";
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    std::getline(std::cin, ciudad);
+                    if (!vista->claveCiudad(ciudad, minimo)) {
+                        std::cout << "No hay personas de " << ciudad << "\n";
+                        break;
+                    }
+                    maximo = minimo;
+                } else {
+                    double desde, hasta;
+                    std::cout << "\nValor mínimo: ";
+                    std::cin >> desde;
+                    std::cout << "Valor máximo: ";
+                    std::cin >> hasta;
+                    minimo = VistaOrdenada::claveMonto(desde);
+                    maximo = VistaOrdenada::claveMonto(hasta);
+                }
+                
+                monitor.iniciar_tiempo();
+                size_t desde, hasta;
+                vista->rango(minimo, maximo, desde, hasta);
+                double tiempo_busqueda = monitor.detener_tiempo();
+                monitor.registrar("Buscar en vista ordenada", tiempo_busqueda, 0);
+                
+                const size_t MAX_MOSTRAR = 20;
+                std::cout << "\n=== " << hasta - desde << " PERSONAS (" << nombreClave(vista->clave())
+                          << ", posiciones " << desde << "-" << hasta << ") ===\n";
+                for (size_t pos = desde; pos < hasta && pos < desde + MAX_MOSTRAR; ++pos) {
+                    uint32_t fila = (*vista)[pos];
+                    std::cout << fila << ". ";
+                    (*personas)[fila].mostrarResumen();
+                    std::cout << "\n";
+                }
+                if (hasta - desde > MAX_MOSTRAR) {
+                    std::cout << "... (" << hasta - desde - MAX_MOSTRAR << " más)\n";
+                }
+                std::cout << "Búsqueda binaria: " << std::fixed << std::setprecision(4)
+                          << tiempo_busqueda << " ms\n";
+                break;
+            }
+                
+            case 18: { // Búsquedas sin copias: asignaciones por búsqueda
+                size_t total = instantanea ? instantanea->size() : personas ? personas->size() : 0;
+                if (total == 0) {
+                    std::cout << "\nNo hay datos en memoria ni instantánea. Use opción 0 o 10 primero.\n";
+                    break;
+                }
+                
+                size_t numBusquedas;
+                std::cout << "\nNúmero de búsquedas por ID";
+                if (instantanea) {
+                    std::cout << " (la instantánea no tiene índice: cada una es lineal)";
+                }
+                std::cout << ": ";
+                std::cin >> numBusquedas;
+                if (numBusquedas == 0) {
+                    std::cout << "Debe hacer al menos una búsqueda!\n";
+                    break;
+                }
+                
+                // IDs existentes elegidos al azar (se preparan fuera de la medición)
+                std::vector<std::string> ids(numBusquedas);
+                for (auto& id : ids) {
+                    size_t fila = static_cast<size_t>(rand()) % total;
+                    id = std::string(instantanea ? PersonaRef((*instantanea)[fila]).id()
+                                                 : PersonaRef((*personas)[fila]).id());
+                }
+                
+                // Una sola consulta para ambos almacenamientos: localizar y leer todos los textos
+                auto medir = [&](const auto& coleccion, auto localizar, bool copiar, const char* operacion) {
+                    unsigned long long caracteres = 0;
+                    monitor.iniciar_tiempo();
+                    iniciarConteoAsignaciones();
+                    for (const auto& id : ids) {
+                        long fila = localizar(id);
+                        if (fila < 0) {
+                            continue;
+                        }
+                        PersonaRef p(coleccion[fila]);
+                        if (copiar) {
+                            // Lo que hacía la API con getters que devolvían std::string por valor
+                            // (la fecha ya no es texto: se copia como entero en ambos casos)
+                            std::string nombre(p.nombre()), apellido(p.apellido()), cedula(p.id()),
+                                        ciudad(p.ciudadNacimiento());
+                            caracteres += nombre.size() + apellido.size() + cedula.size() + ciudad.size();
+                        } else {
+                            caracteres += p.nombre().size() + p.apellido().size() + p.id().size()
+                                        + p.ciudadNacimiento().size();
+                        }
+                    }
+                    unsigned long long asignaciones = detenerConteoAsignaciones();
+                    double tiempo = monitor.detener_tiempo();
+                    monitor.registrar_flujo(operacion, tiempo, 0, numBusquedas, caracteres);
+                    std::cout << operacion << ": " << std::fixed << std::setprecision(2)
+                              << tiempo * 1e6 / numBusquedas << " ns/búsqueda, "
+                              << static_cast<double>(asignaciones) / numBusquedas
+                              << " asignaciones/búsqueda (" << asignaciones << " en total)\n";
+                };
+                
+                std::cout << "\n=== " << numBusquedas << " BÚSQUEDAS POR ID ("
+                          << (instantanea ? "instantánea" : "memoria, índice hash") << ") ===\n";
+                if (instantanea) {
+                    auto localizar = [&](const std::string& id) { return instantanea->buscarPorID(id); };
+                    medir(*instantanea, localizar, true, "Búsqueda + copia de textos");
+                    medir(*instantanea, localizar, false, "Búsqueda + PersonaRef");
+                } else {
+                    auto localizar = [&](const std::string& id) { return indiceID.buscar(id); };
+                    medir(*personas, localizar, true, "Búsqueda + copia de textos");
+                    medir(*personas, localizar, false, "Búsqueda + PersonaRef");
+                }
+                break;
+            }
+                
+            case 19: { // Agregar personas a la colección actual
+                if (instantanea) {
+                    std::cout << "\nLa instantánea es de solo lectura. Use opción 0 o 12 para una colección en memoria.\n";
+                    break;
+                }
+                if (!personas && !coleccionVirtual) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                long long n;
+                std::cout << "\nNúmero de personas a agregar: ";
+                std::cin >> n;
+                if (n <= 0) {
+                    std::cout << "Error: Debe agregar al menos 1 persona\n";
+                    break;
+                }
+                
+                if (coleccionVirtual) {
+                    // Los registros virtuales se calculan bajo demanda: solo cambia el tamaño
+                    monitor.iniciar_tiempo();
+                    coleccionVirtual->crecer(static_cast<uint64_t>(n));
+                    double tiempo_crecer = monitor.detener_tiempo();
+                    std::cout << "Colección virtual: " << coleccionVirtual->size() << " personas\n";
+                    monitor.registrar_flujo("Agregar personas (virtual)", tiempo_crecer, 0, n, 0);
+                    break;
+                }
+                
+                const size_t desde = personas->size();
+                if (desde + static_cast<size_t>(n) > static_cast<size_t>(std::numeric_limits<int>::max())) {
+                    std::cout << "Error: La colección en memoria admite hasta "
+                              << std::numeric_limits<int>::max() << " personas\n";
+                    break;
+                }
+                unsigned long long semilla;
+                unsigned hilos = 0;
+                std::cout << "Semilla: ";
+                std::cin >> semilla;
+                std::cout << "Hilos (0 = todos los núcleos): ";
+                std::cin >> hilos;
+                
+                // Las cédulas continúan después de la mayor indexada
+                long primerID = std::max(ID_INICIAL + static_cast<long>(desde),
+                                         static_cast<long>(indiceID.cedulaMaxima()) + 1);
+                
+                monitor.iniciar_tiempo();
+                agregarPersonasParalelo(*personas, static_cast<size_t>(n), semilla, primerID, hilos);
+                double tiempo_datos = monitor.detener_tiempo();
+                
+                // Índices: solo las filas nuevas (sin reiniciar el cronómetro)
+                indiceID.agregar(*personas, desde);
+                double tiempo_id = monitor.detener_tiempo() - tiempo_datos;
+                size_t tramos = 0;
+                for (int c = 0; c < 3; ++c) {
+                    indicesRango[c].agregar(*personas, desde);
+                    tramos = std::max(tramos, indicesRango[c].numTramos());
+                }
+                double tiempo_rango = monitor.detener_tiempo() - tiempo_datos - tiempo_id;
+                double tiempo_agregar = tiempo_datos + tiempo_id + tiempo_rango;
+                long memoria_agregar = monitor.obtener_memoria() - memoria_inicio;
+                
+                if (vista) {
+                    // Reordenar la permutación completa sería O(total): se descarta
+                    vista.reset();
+                    std::cout << "Vista ordenada descartada (use opción 16 para reconstruirla)\n";
+                }
+                
+                std::cout << "Agregadas " << n << " personas (total " << personas->size() << ") en "
+                          << std::fixed << std::setprecision(2) << tiempo_agregar << " ms: datos "
+                          << tiempo_datos << " ms, índice ID " << tiempo_id << " ms, índices de rango "
+                          << tiempo_rango << " ms (" << tramos << " tramos pendientes)\n"
+                          << "Costo por persona agregada: " << tiempo_agregar * 1e6 / n << " ns\n";
+                monitor.registrar_flujo("Agregar personas", tiempo_agregar, memoria_agregar, n,
+                                        static_cast<unsigned long long>(n) * sizeof(Persona));
+                monitor.registrar("Actualizar índice ID", tiempo_id, 0);
+                monitor.registrar("Actualizar índices rango", tiempo_rango, 0);
+                break;
+            }
+                
+            case 20: { // Actualizar un campo financiero en sitio
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos en memoria (la instantánea y la colección virtual son de solo lectura). Use opción 0 o 12 primero.\n";
+                    break;
+                }
+                
+                std::cout << "\nID de la persona: ";
+                std::cin >> idBusqueda;
+                CampoFinanciero campo;
+                if (!leerCampo(campo)) {
+                    break;
+                }
+                double valor;
+                std::cout << "Nuevo valor: ";
+                if (!(std::cin >> valor)) {
+                    std::cout << "Valor inválido!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    break;
+                }
+                
+                monitor.iniciar_tiempo();
+                long fila = indiceID.buscar(idBusqueda);
+                if (fila < 0) {
+                    std::cout << "No se encontró persona con ID " << idBusqueda << "\n";
+                    break;
+                }
+                // Se escribe el campo y el índice de ese campo registra baja + alta
+                Persona& p = (*personas)[fila];
+                double anterior = valorCampo(p, campo);
+                asignarCampo(p, campo, valor);
+                indicesRango[static_cast<int>(campo)].actualizar(static_cast<uint32_t>(fila), anterior, valor);
+                double tiempo_actualizar = monitor.detener_tiempo();
+                
+                if (vista && ((vista->clave() == ClaveOrden::Ingresos && campo == CampoFinanciero::Ingresos)
+                              || (vista->clave() == ClaveOrden::Patrimonio && campo == CampoFinanciero::Patrimonio))) {
+                    vista.reset();
+                    std::cout << "Vista ordenada descartada: su clave cambió (use opción 16 para reconstruirla)\n";
+                }
+                
+                std::cout << std::fixed << std::setprecision(2) << idBusqueda << " (fila " << fila << "): "
+                          << nombreCampo(campo) << " $" << anterior << " -> $" << valor << " en "
+                          << std::setprecision(4) << tiempo_actualizar << " ms ("
+                          << indicesRango[static_cast<int>(campo)].numTramos() << " tramos pendientes)\n";
+                monitor.registrar("Actualizar campo", tiempo_actualizar, 0);
+                break;
+            }
+                
+            case 21: { // Eliminar personas: lápida + bajas en los índices
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos en memoria (la instantánea y la colección virtual son de solo lectura). Use opción 0 o 12 primero.\n";
+                    break;
+                }
+                
+                uint64_t cedula;
+                unsigned long long cantidad;
+                std::cout << "\nID inicial: ";
+                std::cin >> idBusqueda;
+                std::cout << "Cantidad de cédulas consecutivas (1 = solo esa): ";
+                std::cin >> cantidad;
+                if (!IndiceID::convertirCedula(idBusqueda, cedula) || cantidad == 0) {
+                    std::cout << "ID o cantidad inválida!\n";
+                    break;
+                }
+                
+                monitor.iniciar_tiempo();
+                size_t eliminadas = 0;
+                for (unsigned long long k = 0; k < cantidad; ++k) {
+                    std::string id = std::to_string(cedula + k);
+                    long fila = indiceID.buscar(id);
+                    if (fila < 0) {
+                        continue; // No existe o ya estaba eliminada
+                    }
+                    const Persona& p = (*personas)[fila];
+                    bajas.marcar(static_cast<size_t>(fila));
+                    for (int c = 0; c < 3; ++c) {
+                        indicesRango[c].eliminar(static_cast<uint32_t>(fila),
+                                                 valorCampo(p, static_cast<CampoFinanciero>(c)));
+                    }
+                    indiceID.eliminar(id);
+                    ++eliminadas;
+                }
+                double tiempo_eliminar = monitor.detener_tiempo();
+                
+                if (eliminadas > 0 && vista) {
+                    // La permutación todavía apunta a las filas eliminadas
+                    vista.reset();
+                    std::cout << "Vista ordenada descartada (use opción 16 para reconstruirla)\n";
+                }
+                
+                double proporcion = bajas.proporcion(personas->size());
+                std::cout << "Eliminadas " << eliminadas << " personas en " << std::fixed << std::setprecision(2)
+                          << tiempo_eliminar << " ms. Lápidas: " << bajas.size() << " de " << personas->size()
+                          << " filas (" << 100.0 * proporcion << "%, "
+                          << bajas.memoria_bytes() / 1024 << " KB)\n";
+                monitor.registrar_flujo("Eliminar personas", tiempo_eliminar, 0, eliminadas, 0);
+                
+                // Pasado el umbral se compacta en otro hilo; el menú sigue atendiendo consultas
+                if (!compactador.enCurso() && proporcion >= UMBRAL_COMPACTACION) {
+                    compactador.iniciar(*personas, bajas);
+                    std::cout << "[COMPACTACIÓN] Iniciada en segundo plano (umbral "
+                              << 100.0 * UMBRAL_COMPACTACION << "%)\n";
+                }
+                break;
+            }
+                
+            case 22: { // Regeneración con lectores concurrentes
+                long long n;
+                unsigned long long semilla;
+                unsigned lectores, hilos = 0;
+                int opcionModo;
+                std::cout << "\nPersonas por versión: ";
+                std::cin >> n;
+                std::cout << "Semilla (la versión nueva usa semilla + 1): ";
+                std::cin >> semilla;
+                std::cout << "Hilos lectores: ";
+                std::cin >> lectores;
+                std::cout << "Hilos para generar (0 = todos los núcleos): ";
+                std::cin >> hilos;
+                std::cout << "Modo (1. Publicación RCU, 2. Cerrojo exclusivo, 3. Ambos): ";
+                std::cin >> opcionModo;
+                if (n <= 0 || n > std::numeric_limits<int>::max() || lectores == 0
+                    || opcionModo < 1 || opcionModo > 3) {
+                    std::cout << "Datos inválidos!\n";
+                    break;
+                }
+                
+                // No toca la colección del menú: cada modo usa sus propias versiones
+                const char* const nombres[] = {"antes", "durante", "después"};
+                const char* const columnas[] = {"antes:   ", "durante: ", "después: "}; // setw cuenta bytes, no letras
+                for (int m = 1; m <= 2; ++m) {
+                    if (opcionModo != 3 && opcionModo != m) {
+                        continue;
+                    }
+                    ModoRegeneracion modo = (m == 1) ? ModoRegeneracion::Publicacion : ModoRegeneracion::Cerrojo;
+                    const std::string etiqueta = (m == 1) ? "RCU" : "cerrojo";
+                    long memoria_antes = monitor.obtener_memoria();
+                    ResultadoRegeneracion r = regenerarConLectores(static_cast<int>(n), semilla, hilos,
+                                                                   lectores, modo);
+                    
+                    std::cout << "\n=== REGENERACIÓN CON " << lectores << " LECTORES ("
+                              << (m == 1 ? "publicación RCU" : "cerrojo exclusivo") << ") ===\n"
+                              << std::fixed << std::setprecision(2)
+                              << "Construcción de la versión nueva: " << r.tiempoConstruccion << " ms\n";
+                    if (m == 1) {
+                        std::cout << "Versión anterior liberada " << r.tiempoLiberacion
+                                  << " ms después de publicar (al salir su último lector)\n";
+                    }
+                    for (int f = 0; f < 3; ++f) {
+                        const LatenciaFase& l = r.fases[f];
+                        std::cout << columnas[f] << l.consultas
+                                  << " consultas (" << (l.duracion > 0 ? l.consultas / l.duracion * 1000.0 : 0)
+                                  << "/s) | p50 " << l.p50 << " ns | p99 " << l.p99 << " ns | p99.9 "
+                                  << l.p999 << " ns | máx " << l.maximo / 1e6 << " ms\n";
+                    }
+                    std::cout << "Consultas con resultado incoherente: " << r.errores << "\n";
+                    for (int f = 0; f < 3; ++f) {
+                        monitor.registrar_flujo("Lectores " + etiqueta + " (" + nombres[f] + ")",
+                                                r.fases[f].duracion, 0, r.fases[f].consultas, 0);
+                    }
+                    monitor.registrar("Regenerar con lectores (" + etiqueta + ")", r.tiempoConstruccion,
+                                      monitor.obtener_memoria() - memoria_antes);
+                }
+                break;
+            }
+                
+            case 23: { // Consulta por edad o por rango de fechas de nacimiento
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos en memoria. Use opción 0 primero.\n";
+                    break;
+                }
+
+                int opcionFiltro;
+                std::cout << "\nFiltrar por (1. Edad, 2. Rango de fechas de nacimiento): ";
+                std::cin >> opcionFiltro;
+                const Fecha hoy = Fecha::hoy();
+                RangoFechas rango;
+                if (opcionFiltro == 1) {
+                    int edadMinima, edadMaxima;
+                    std::cout << "Edad mínima: ";
+                    std::cin >> edadMinima;
+                    std::cout << "Edad máxima: ";
+                    std::cin >> edadMaxima;
+                    if (edadMinima < 0 || edadMaxima < edadMinima || edadMaxima > 150) {
+                        std::cout << "Rango de edades inválido!\n";
+                        break;
+                    }
+                    rango = RangoFechas::porEdad(edadMinima, edadMaxima, hoy);
+                } else if (opcionFiltro == 2) {
+                    std::string desde, hasta;
+                    std::cout << "Desde (D/M/AAAA): ";
+                    std::cin >> desde;
+                    std::cout << "Hasta (D/M/AAAA): ";
+                    std::cin >> hasta;
+                    rango.desde = Fecha::desdeTexto(desde);
+                    rango.hasta = Fecha::desdeTexto(hasta);
+                    if (!rango.desde.valida() || !rango.hasta.valida() || rango.hasta < rango.desde) {
+                        std::cout << "Fechas inválidas!\n";
+                        break;
+                    }
+                } else {
+                    std::cout << "Filtro inválido!\n";
+                    break;
+                }
+
+                // 1) Consulta sobre la fecha empaquetada: comparaciones de enteros
+                const size_t n = personas->size();
+                const size_t LIMITE_FILAS = 10;
+                std::vector<size_t> primeras;
+                monitor.iniciar_tiempo();
+                size_t total = contarNacidosEn(*personas, rango, &bajas, &primeras, LIMITE_FILAS);
+                double tiempo_binario = monitor.detener_tiempo();
+                monitor.registrar_flujo("Consulta por nacimiento (fecha binaria)", tiempo_binario, 0,
+                                        n, n * sizeof(Fecha));
+
+                // 2) Referencia: la misma consulta con las fechas como texto "D/M/AAAA"
+                std::vector<std::string> textos;
+                textos.reserve(n);
+                for (const auto& p : *personas) {
+                    textos.push_back(p.getFechaNacimiento().texto());
+                }
+                monitor.iniciar_tiempo();
+                size_t totalTexto = contarNacidosEnTexto(textos, rango, &bajas);
+                double tiempo_texto = monitor.detener_tiempo();
+                monitor.registrar_flujo("Consulta por nacimiento (texto)", tiempo_texto, 0, n, 0);
+                std::vector<std::string>().swap(textos);
+
+                // 3) Generación de n fechas con cada representación (mismos valores)
+                ComparacionGeneracionFechas g = compararGeneracionFechas(n, static_cast<uint64_t>(rand()));
+                monitor.registrar_flujo("Generar fechas (texto)", g.tiempoTexto, 0, n, g.bytesTexto);
+                monitor.registrar_flujo("Generar fechas (binaria)", g.tiempoBinario, 0, n, g.bytesBinario);
+
+                std::cout << "\n=== NACIDOS ENTRE " << rango.desde << " Y " << rango.hasta
+                          << " (hoy " << hoy << ") ===\n"
+                          << "Coincidencias: " << total << " de " << n - bajas.size();
+                if (totalTexto != total) {
+                    std::cout << " (ERROR: la consulta sobre texto da " << totalTexto << ")";
+                }
+                std::cout << "\n";
+                for (size_t fila : primeras) {
+                    const Persona& p = (*personas)[fila];
+                    p.mostrarResumen();
+                    std::cout << " | " << p.getFechaNacimiento() << " ("
+                              << p.getFechaNacimiento().edadEn(hoy) << " años)\n";
+                }
+                if (total > primeras.size()) {
+                    std::cout << "... (" << total - primeras.size() << " más)\n";
+                }
+
+                auto porSegundo = [](size_t cantidad, double ms) { return ms > 0 ? cantidad / ms / 1000.0 : 0; };
+                std::cout << std::fixed << std::setprecision(2)
+                          << "\nConsulta (fecha binaria): " << tiempo_binario << " ms, "
+                          << porSegundo(n, tiempo_binario) << " M personas/s\n"
+                          << "Consulta (texto D/M/AAAA): " << tiempo_texto << " ms, "
+                          << porSegundo(n, tiempo_texto) << " M personas/s"
+                          << " (binaria " << (tiempo_binario > 0 ? tiempo_texto / tiempo_binario : 0) << "x)\n"
+                          << "Generar fechas (texto):    " << g.tiempoTexto << " ms, "
+                          << porSegundo(n, g.tiempoTexto) << " M fechas/s, "
+                          << static_cast<double>(g.bytesTexto) / n << " bytes/fecha\n"
+                          << "Generar fechas (binaria):  " << g.tiempoBinario << " ms, "
+                          << porSegundo(n, g.tiempoBinario) << " M fechas/s, "
+                          << static_cast<double>(g.bytesBinario) / n << " bytes/fecha"
+                          << " (" << (g.tiempoBinario > 0 ? g.tiempoTexto / g.tiempoBinario : 0) << "x)\n";
+                if (g.diferencias > 0) {
+                    std::cout << "ERROR: " << g.diferencias << " fechas de texto no coinciden con su código\n";
+                }
+                break;
+            }
+
+            case 24: { // Colección fuera de memoria en un archivo mapeado
+                long long n;
+                std::cout << "\nPersonas a generar en el archivo (0 = usar la colección mapeada actual): ";
+                std::cin >> n;
+                if (n < 0 || (n == 0 && !mapeada)) {
+                    std::cout << "No hay colección mapeada. Indique cuántas personas generar.\n";
+                    break;
+                }
+                if (n > 0) {
+                    std::string ruta;
+                    unsigned long long semilla;
+                    unsigned hilos;
+                    std::cout << "Archivo de trabajo (se borra al cerrar la colección): ";
+                    std::cin >> ruta;
+                    std::cout << "Semilla: ";
+                    std::cin >> semilla;
+                    std::cout << "Hilos (0 = todos los núcleos): ";
+                    std::cin >> hilos;
+                    
+                    mapeada.reset(); // Libera el archivo anterior antes de reservar el nuevo
+                    auto nueva = std::make_unique<ColeccionMapeada>();
+                    long memoria_antes = monitor.obtener_memoria();
+                    monitor.iniciar_tiempo();
+                    if (!nueva->crear(ruta, static_cast<size_t>(n), semilla, hilos)) {
+                        std::cout << "No se pudo crear la colección mapeada\n";
+                        break;
+                    }
+                    double tiempo_crear = monitor.detener_tiempo();
+                    long memoria_crear = monitor.obtener_memoria() - memoria_antes;
+                    monitor.registrar_flujo("Crear colección mapeada", tiempo_crear, memoria_crear,
+                                            nueva->size(), nueva->bytes_mapeados());
+                    std::cout << "Generadas " << nueva->size() << " personas en " << tiempo_crear
+                              << " ms (" << nueva->bytes_mapeados() / (1024 * 1024) << " MB de archivo, "
+                              << sizeof(RegistroMapeado) << " bytes/persona), memoria residente: "
+                              << memoria_crear << " KB\n";
+                    mapeada = std::move(nueva);
+                }
+                
+                int enFrio;
+                size_t busquedas;
+                std::cout << "Vaciar el caché de páginas antes de cada medición (1. Sí, 0. No): ";
+                std::cin >> enFrio;
+                std::cout << "Búsquedas aleatorias por ID: ";
+                std::cin >> busquedas;
+                
+                // Agregados de un recorrido completo (se comparan entre ambos recorridos)
+                struct Totales {
+                    size_t declarantes = 0;
+                    double ingresos = 0, patrimonio = 0, deudas = 0;
+                };
+                const size_t total = mapeada->size();
+                auto medirRecorrido = [&](bool conConsejos, const std::string& etiqueta) {
+                    if (enFrio == 1) {
+                        mapeada->liberarCache();
+                    }
+                    Totales t;
+                    long memoria_antes = monitor.obtener_memoria();
+                    monitor.iniciar_tiempo();
+                    mapeada->recorrer([&t](const RegistroMapeado& r) {
+                        t.declarantes += r.declaranteRenta;
+                        t.ingresos += r.ingresosAnuales;
+                        t.patrimonio += r.patrimonio;
+                        t.deudas += r.deudas;
+                    }, conConsejos);
+                    double tiempo = monitor.detener_tiempo();
+                    long memoria = monitor.obtener_memoria() - memoria_antes;
+                    monitor.registrar_flujo(etiqueta, tiempo, memoria, total, mapeada->bytes_mapeados());
+                    std::cout << std::fixed << std::setprecision(2) << etiqueta << ": " << tiempo
+                              << " ms, " << monitor.fallos_mayores() << " fallos mayores, memoria residente "
+                              << (memoria >= 0 ? "+" : "") << memoria << " KB\n";
+                    return t;
+                };
+                
+                std::cout << "\n=== COLECCIÓN MAPEADA: " << total << " PERSONAS ("
+                          << mapeada->bytes_mapeados() / (1024 * 1024) << " MB) ===\n";
+                
+                // 1) Recorridos secuenciales: sin consejos y con ventanas + madvise
+                Totales sinConsejos = medirRecorrido(false, "Recorrido mapeado (sin madvise)");
+                Totales conConsejos = medirRecorrido(true, "Recorrido mapeado (SEQUENTIAL + WILLNEED)");
+                std::cout << "Declarantes: " << conConsejos.declarantes << " de " << total
+                          << " | Ingresos promedio: " << conConsejos.ingresos / total
+                          << " | Patrimonio neto promedio: "
+                          << (conConsejos.patrimonio - conConsejos.deudas) / total << "\n";
+                if (sinConsejos.declarantes != conConsejos.declarantes
+                    || sinConsejos.ingresos != conConsejos.ingresos) {
+                    std::cout << "ERROR: los dos recorridos no dan los mismos totales\n";
+                }
+                
+                // 2) Búsquedas puntuales de cédulas al azar con MADV_RANDOM
+                if (busquedas > 0) {
+                    if (enFrio == 1) {
+                        mapeada->liberarCache();
+                    }
+                    MotorAleatorio motor(static_cast<uint64_t>(rand()));
+                    size_t encontradas = 0;
+                    long primera = -1;
+                    monitor.iniciar_tiempo();
+                    mapeada->prepararBusquedas();
+                    for (size_t k = 0; k < busquedas; ++k) {
+                        uint64_t id = static_cast<uint64_t>(ID_INICIAL) + motor.siguiente() % total;
+                        long fila = mapeada->buscarPorID(id);
+                        encontradas += fila >= 0;
+                        if (primera < 0) {
+                            primera = fila;
+                        }
+                    }
+                    double tiempo_busquedas = monitor.detener_tiempo();
+                    monitor.registrar_flujo("Búsquedas mapeadas (RANDOM)", tiempo_busquedas, 0, busquedas, 0);
+                    std::cout << "Búsquedas mapeadas (RANDOM): " << busquedas << " en " << tiempo_busquedas
+                              << " ms (" << tiempo_busquedas * 1000.0 / busquedas << " us/búsqueda), "
+                              << monitor.fallos_mayores() << " fallos mayores ("
+                              << static_cast<double>(monitor.fallos_mayores()) / busquedas
+                              << " por búsqueda), encontradas: " << encontradas << "\n";
+                    if (primera >= 0) {
+                        std::cout << "Primera encontrada: ";
+                        mapeada->persona(static_cast<size_t>(primera)).mostrarResumen();
+                        std::cout << "\n";
+                    }
+                }
+                break;
+            }
+
+            case OPCION_SALIR: // Salir
                 std::cout << "Saliendo...\n";
                 break;
                 
@@ -168,14 +1621,19 @@ int main() {
                 std::cout << "Opción inválida!\n";
         }
         
-        // Mostrar estadísticas de la operación (excepto para opciones 4,5,6)
-        if (opcion >= 0 && opcion <= 3) {
+        // Las opciones fijan std::fixed y setprecision para sus tiempos y montos;
+        // sin restaurar, ese formato se filtraría a las opciones siguientes
+        std::cout.flags(formatoCout);
+        std::cout.precision(precisionCout);
+        
+        // Mostrar estadísticas de la operación (excepto para opciones 4, 5 y salir)
+        if (opcion >= 0 && opcion < OPCION_SALIR && opcion != 4 && opcion != 5) {
             double tiempo = monitor.detener_tiempo();
             long memoria = monitor.obtener_memoria() - memoria_inicio;
             monitor.mostrar_estadistica("Opción " + std::to_string(opcion), tiempo, memoria);
         }
         
-    } while(opcion != 6);
+    } while(opcion != OPCION_SALIR);
     
     return 0;
 }
\ No newline at end of file
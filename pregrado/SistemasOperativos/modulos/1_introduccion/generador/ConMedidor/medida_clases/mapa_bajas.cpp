@@ -0,0 +1,24 @@
+#include "mapa_bajas.h"
+
+bool MapaBajas::marcar(size_t fila) {
+    size_t palabra = fila >> 6;
+    if (palabra >= bits.size()) {
+        bits.resize(palabra + 1, 0);
+    }
+    uint64_t mascara = uint64_t{1} << (fila & 63);
+    if (bits[palabra] & mascara) {
+        return false;
+    }
+    bits[palabra] |= mascara;
+    ++total;
+    return true;
+}
+
+double MapaBajas::proporcion(size_t filas) const {
+    return filas == 0 ? 0.0 : static_cast<double>(total) / static_cast<double>(filas);
+}
+
+void MapaBajas::limpiar() {
+    std::vector<uint64_t>().swap(bits); // Libera la memoria de verdad
+    total = 0;
+}
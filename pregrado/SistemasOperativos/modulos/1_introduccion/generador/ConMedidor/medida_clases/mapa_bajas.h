@@ -0,0 +1,49 @@
+#ifndef MAPA_BAJAS_H
+#define MAPA_BAJAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Mapa de bits de filas eliminadas (lápidas).
+ *
+ * POR QUÉ: Quitar una persona del medio del vector movería todas las siguientes
+ *          y cambiaría las filas que guardan los índices y la vista ordenada.
+ * CÓMO: Un bit por fila en palabras de 64 bits; eliminar solo enciende el bit y
+ *       los recorridos lo consultan antes de leer la persona. Las filas siguen
+ *       ocupando espacio hasta que la compactación las descarta.
+ * PARA QUÉ: Eliminar en O(1) con un costo por fila recorrida de una lectura de bit
+ *           (1 bit por fila: 6 MB para 50M personas).
+ */
+class MapaBajas {
+public:
+    /**
+     * Marca una fila como eliminada (el mapa crece hasta ella si hace falta).
+     *
+     * @return false si la fila ya estaba eliminada.
+     */
+    bool marcar(size_t fila);
+
+    // true si la fila está eliminada; las filas fuera del mapa están vivas
+    bool eliminada(size_t fila) const {
+        size_t palabra = fila >> 6;
+        return palabra < bits.size() && ((bits[palabra] >> (fila & 63)) & 1);
+    }
+
+    // Número de filas eliminadas
+    size_t size() const { return total; }
+    bool vacio() const { return total == 0; }
+
+    // Fracción de 'filas' que está eliminada
+    double proporcion(size_t filas) const;
+
+    void limpiar();
+    size_t memoria_bytes() const { return bits.capacity() * sizeof(uint64_t); }
+
+private:
+    std::vector<uint64_t> bits;
+    size_t total = 0;
+};
+
+#endif // MAPA_BAJAS_H
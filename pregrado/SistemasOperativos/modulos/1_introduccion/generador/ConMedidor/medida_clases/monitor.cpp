@@ -1,15 +1,17 @@
 #include "monitor.h"
 #include <unistd.h> // sysconf
+#include <sys/resource.h> // getrusage
 #include <cstdio>   // FILE, fscanf
 
 /**
  * Inicia el cronómetro.
  * 
  * POR QUÉ: Comenzar a medir el tiempo de una operación.
- * CÓMO: Guardando el tiempo actual en 'inicio'.
- * PARA QUÉ: Poder calcular la duración después.
+ * CÓMO: Guardando el tiempo actual en 'inicio' y los fallos mayores acumulados.
+ * PARA QUÉ: Poder calcular la duración y los fallos después.
  */
 void Monitor::iniciar_tiempo() {
+    fallos_inicio = fallos_fin = leer_fallos_mayores();
     inicio = std::chrono::high_resolution_clock::now();
 }
 
@@ -23,10 +25,38 @@ void Monitor::iniciar_tiempo() {
  */
 double Monitor::detener_tiempo() {
     auto fin = std::chrono::high_resolution_clock::now();
+    fallos_fin = leer_fallos_mayores();
     std::chrono::duration<double, std::milli> duracion = fin - inicio;
     return duracion.count();
 }
 
+/**
+ * Lee los fallos de página mayores acumulados del proceso.
+ * 
+ * POR QUÉ: Un fallo mayor es una página que hubo que leer del disco; con datos
+ *          más grandes que la RAM dominan el tiempo de las operaciones.
+ * CÓMO: getrusage(RUSAGE_SELF).ru_majflt (incluye todos los hilos).
+ * @return Fallos mayores desde que arrancó el proceso, o 0 en caso de error.
+ */
+long Monitor::leer_fallos_mayores() {
+    struct rusage uso;
+    if (getrusage(RUSAGE_SELF, &uso) != 0) {
+        return 0;
+    }
+    return uso.ru_majflt;
+}
+
+/**
+ * Fallos mayores de la última operación cronometrada.
+ * 
+ * POR QUÉ: Distinguir una operación lenta por CPU de una que espera al disco.
+ * CÓMO: Diferencia entre los contadores leídos en iniciar_tiempo y detener_tiempo.
+ * PARA QUÉ: Se guarda con cada registro y se muestra junto al tiempo.
+ */
+long Monitor::fallos_mayores() const {
+    return fallos_fin - fallos_inicio;
+}
+
 /**
  * Obtiene la memoria residente actual (RSS) del proceso en KB.
  * 
@@ -64,13 +94,38 @@ long Monitor::obtener_memoria() {
  * PARA QUÉ: Tener un histórico de rendimiento.
  */
 void Monitor::registrar(const std::string& operacion, double tiempo, long memoria) {
-    registros.push_back({operacion, tiempo, memoria});
+    registros.push_back({operacion, tiempo, memoria, 0.0, 0.0, fallos_mayores()});
     total_tiempo += tiempo;
     if (memoria > max_memoria) {
         max_memoria = memoria;
     }
 }
 
+/**
+ * Registra una operación de flujo con su tasa de procesamiento.
+ * 
+ * POR QUÉ: En generación y escritura masiva importa la tasa, no solo el tiempo.
+ * CÓMO: Calcula registros/s y MB/s a partir del tiempo medido y los guarda
+ *       junto con el registro normal.
+ * PARA QUÉ: Comparar sumideros (disco, CSV, nulo) y formatos entre sí.
+ */
+void Monitor::registrar_flujo(const std::string& operacion, double tiempo, long memoria,
+                              unsigned long long registros_procesados, unsigned long long bytes) {
+    double segundos = tiempo / 1000.0;
+    double registros_s = segundos > 0 ? registros_procesados / segundos : 0.0;
+    double mb_s = segundos > 0 ? (bytes / (1024.0 * 1024.0)) / segundos : 0.0;
+    
+    registros.push_back({operacion, tiempo, memoria, registros_s, mb_s, fallos_mayores()});
+    total_tiempo += tiempo;
+    if (memoria > max_memoria) {
+        max_memoria = memoria;
+    }
+    
+    std::cout << "\n[FLUJO] " << operacion << " - "
+              << static_cast<unsigned long long>(registros_s) << " registros/s, "
+              << mb_s << " MB/s\n";
+}
+
 /**
  * Muestra las estadísticas de una operación.
  * 
@@ -81,7 +136,8 @@ void Monitor::registrar(const std::string& operacion, double tiempo, long memori
 void Monitor::mostrar_estadistica(const std::string& operacion, double tiempo, long memoria) {
     std::cout << "\n[ESTADÍSTICAS] " << operacion << " - "
               << "Tiempo: " << tiempo << " ms, "
-              << "Memoria: " << memoria << " KB\n";
+              << "Memoria: " << memoria << " KB, "
+              << "Fallos mayores: " << fallos_mayores() << "\n";
 }
 
 /**
@@ -96,6 +152,13 @@ void Monitor::mostrar_resumen() {
     for (const auto& reg : registros) {
         std::cout << "\n" << reg.operacion << ": "
                   << reg.tiempo << " ms, " << reg.memoria << " KB";
+        if (reg.registros_s > 0) {
+            std::cout << ", " << static_cast<unsigned long long>(reg.registros_s)
+                      << " registros/s, " << reg.mb_s << " MB/s";
+        }
+        if (reg.fallos > 0) {
+            std::cout << ", " << reg.fallos << " fallos mayores";
+        }
     }
     std::cout << "\nTotal tiempo: " << total_tiempo << " ms";
     std::cout << "\nMemoria máxima: " << max_memoria << " KB\n";
@@ -115,9 +178,10 @@ void Monitor::exportar_csv(const std::string& nombre_archivo) {
         std::cerr << "Error al abrir archivo: " << nombre_archivo << std::endl;
         return;
     }
-    archivo << "Operacion,Tiempo(ms),Memoria(KB)\n";
+    archivo << "Operacion,Tiempo(ms),Memoria(KB),Registros/s,MB/s,FallosMayores\n";
     for (const auto& reg : registros) {
-        archivo << reg.operacion << "," << reg.tiempo << "," << reg.memoria << "\n";
+        archivo << reg.operacion << "," << reg.tiempo << "," << reg.memoria << ","
+                << reg.registros_s << "," << reg.mb_s << "," << reg.fallos << "\n";
     }
     archivo.close();
     std::cout << "Estadísticas exportadas a " << nombre_archivo << "\n";
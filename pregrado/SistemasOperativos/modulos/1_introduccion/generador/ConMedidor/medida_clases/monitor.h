@@ -11,7 +11,8 @@
  * Clase para monitorear el rendimiento (tiempo y memoria).
  * 
  * POR QUÉ: Cuantificar el rendimiento de las operaciones.
- * CÓMO: Midiendo tiempo con chrono y memoria con /proc/self/statm (Linux).
+ * CÓMO: Midiendo tiempo con chrono, memoria con /proc/self/statm (Linux) y
+ *       fallos de página mayores (lecturas de disco) con getrusage.
  * PARA QUÉ: Optimización y análisis de rendimiento.
  */
 class Monitor {
@@ -19,8 +20,11 @@ public:
     void iniciar_tiempo();
     double detener_tiempo();
     long obtener_memoria();
+    long fallos_mayores() const; // Fallos mayores entre iniciar_tiempo y detener_tiempo
     
     void registrar(const std::string& operacion, double tiempo, long memoria);
+    void registrar_flujo(const std::string& operacion, double tiempo, long memoria,
+                         unsigned long long registros_procesados, unsigned long long bytes);
     void mostrar_estadistica(const std::string& operacion, double tiempo, long memoria);
     void mostrar_resumen();
     void exportar_csv(const std::string& nombre_archivo = "estadisticas.csv");
@@ -31,9 +35,16 @@ private:
         std::string operacion; // Nombre de la operación
         double tiempo;         // Tiempo en milisegundos
         long memoria;          // Memoria en KB
+        double registros_s;    // Registros por segundo (0 si no aplica)
+        double mb_s;           // Megabytes por segundo (0 si no aplica)
+        long fallos;           // Fallos de página mayores durante la operación
     };
     
+    static long leer_fallos_mayores(); // ru_majflt acumulado del proceso
+    
     std::chrono::high_resolution_clock::time_point inicio; // Punto de inicio del cronómetro
+    long fallos_inicio = 0;          // ru_majflt al iniciar el cronómetro
+    long fallos_fin = 0;             // ru_majflt al detenerlo
     std::vector<Registro> registros; // Historial de registros
     double total_tiempo = 0;         // Tiempo total acumulado
     long max_memoria = 0;            // Máximo de memoria utilizado
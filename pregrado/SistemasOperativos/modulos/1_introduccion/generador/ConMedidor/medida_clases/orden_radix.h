@@ -0,0 +1,99 @@
+#ifndef ORDEN_RADIX_H
+#define ORDEN_RADIX_H
+
+#include "persona.h"
+#include "mapa_bajas.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Claves por las que se puede ordenar la colección.
+ */
+enum class ClaveOrden { Cedula, Ingresos, Patrimonio, Ciudad };
+
+// Nombre legible de la clave
+const char* nombreClave(ClaveOrden clave);
+
+/**
+ * Ordena pares (clave, índice) por clave con radix sort LSD paralelo.
+ *
+ * POR QUÉ: Ordenar registros grandes mueve todos sus bytes y compara campo a campo.
+ * CÓMO: Pasadas de 8 bits desde el byte menos significativo. En cada pasada
+ *       cada hilo cuenta su tramo (histograma propio), las sumas prefijas por
+ *       (dígito, hilo) dan a cada hilo sus posiciones de destino y luego cada
+ *       uno reparte su tramo sin cerrojos. Se omiten los bytes que son iguales
+ *       en todas las claves (p. ej. los altos de una cédula).
+ * PARA QUÉ: O(n) por pasada, estable, sobre 12 bytes por elemento.
+ *
+ * @param claves Claves sin signo (se ordenan junto con 'indices').
+ * @param indices Índices que acompañan a cada clave.
+ * @param hilos Número de hilos (0 = todos los núcleos).
+ * @return Número de pasadas realizadas.
+ */
+unsigned ordenarRadixParalelo(std::vector<uint64_t>& claves, std::vector<uint32_t>& indices,
+                              unsigned hilos);
+
+/**
+ * Vista ordenada de la colección: una permutación de filas, sin mover los registros.
+ *
+ * POR QUÉ: Listar o buscar en orden no debe exigir reordenar el vector de personas.
+ * CÓMO: Convierte la clave de cada persona a un entero sin signo que conserva el
+ *       orden (cédula numérica, bits de un double ajustados, posición alfabética
+ *       de la ciudad), ordena los pares con ordenarRadixParalelo y guarda las
+ *       claves ordenadas para búsquedas binarias.
+ * PARA QUÉ: Listados ordenados y consultas por rango en O(log n).
+ */
+class VistaOrdenada {
+public:
+    /**
+     * Construye la vista sobre una colección.
+     * @param hilos Número de hilos (0 = todos los núcleos).
+     * @param bajas Filas eliminadas que quedan fuera de la vista (nullptr = ninguna).
+     */
+    void construir(const std::vector<Persona>& personas, ClaveOrden clave, unsigned hilos,
+                   const MapaBajas* bajas = nullptr);
+
+    ClaveOrden clave() const { return tipo; }
+    size_t size() const { return indices.size(); }
+    bool vacia() const { return indices.empty(); }
+    unsigned pasadas() const { return numPasadas; }
+
+    // Fila de la colección que ocupa la posición 'pos' del orden
+    uint32_t operator[](size_t pos) const { return indices[pos]; }
+
+    /**
+     * Posiciones [desde, hasta) cuyas claves están en [minimo, maximo].
+     *
+     * CÓMO: Dos búsquedas binarias sobre las claves ordenadas.
+     */
+    void rango(uint64_t minimo, uint64_t maximo, size_t& desde, size_t& hasta) const;
+
+    // Clave ordenable de un monto (mismo orden que el double)
+    static uint64_t claveMonto(double valor);
+
+    // Clave ordenable de una cédula (IDs no numéricos van al final)
+    static uint64_t claveCedula(const std::string& id);
+
+    /**
+     * Clave ordenable de una ciudad por su nombre.
+     * @return false si el texto no está en el Diccionario (cualquier texto
+     *         internado, sea o no una ciudad, tiene clave).
+     */
+    bool claveCiudad(const std::string& nombre, uint64_t& clave) const;
+
+    // Clave ordenable de una persona según el tipo de la vista
+    uint64_t claveDe(const Persona& p) const;
+
+    size_t memoria_bytes() const;
+
+private:
+    ClaveOrden tipo = ClaveOrden::Cedula;
+    std::vector<uint64_t> claves;             // Claves en orden ascendente
+    std::vector<uint32_t> indices;            // Fila correspondiente a cada clave
+    std::vector<uint32_t> posicionAlfabetica; // Código del diccionario -> posición alfabética
+    std::vector<uint32_t> codigosAlfabeticos; // Posición alfabética -> código del diccionario
+    unsigned numPasadas = 0;
+};
+
+#endif // ORDEN_RADIX_H
@@ -1,54 +1,57 @@
 #include "persona.h"
-#include <iomanip> // Para std::setprecision
+#include "persona_ref.h"
 
 /**
  * Implementación del constructor de Persona.
  * 
  * POR QUÉ: Inicializar los miembros de la clase.
- * CÓMO: Usando la lista de inicialización y moviendo los strings para evitar copias.
+ * CÓMO: Internando los textos repetidos, empaquetando la fecha y moviendo el id.
  * PARA QUÉ: Eficiencia y correcta construcción del objeto.
  */
 Persona::Persona(std::string nom, std::string ape, std::string id, 
                  std::string ciudad, std::string fecha, double ingresos, 
                  double patri, double deud, bool declara)
-    : nombre(std::move(nom)), 
-      apellido(std::move(ape)), 
+    : nombre(Diccionario::global().internar(nom)), 
+      apellido(Diccionario::global().internar(ape)), 
+      ciudadNacimiento(Diccionario::global().internar(ciudad)),
       id(std::move(id)), 
-      ciudadNacimiento(std::move(ciudad)),
-      fechaNacimiento(std::move(fecha)), 
+      fechaNacimiento(Fecha::desdeTexto(fecha)), 
       ingresosAnuales(ingresos), 
       patrimonio(patri),
       deudas(deud), 
       declaranteRenta(declara) {}
 
+Persona::Persona(uint32_t codNombre, uint32_t codApellido, std::string id,
+                 uint32_t codCiudad, Fecha fecha, double ingresos,
+                 double patri, double deud, bool declara)
+    : nombre(codNombre),
+      apellido(codApellido),
+      ciudadNacimiento(codCiudad),
+      id(std::move(id)),
+      fechaNacimiento(fecha),
+      ingresosAnuales(ingresos),
+      patrimonio(patri),
+      deudas(deud),
+      declaranteRenta(declara) {}
+
 /**
  * Implementación de mostrar.
  * 
  * POR QUÉ: Mostrar todos los datos de la persona de forma estructurada.
- * CÓMO: Usando flujos de salida y formateadores.
+ * CÓMO: Delegando en PersonaRef, que comparte el formato con la instantánea.
  * PARA QUÉ: Facilitar la lectura de los datos completos de una persona.
  */
 void Persona::mostrar() const {
-    std::cout << "-------------------------------------\n";
-    std::cout << "[" << id << "] Nombre: " << nombre << " " << apellido << "\n";
-    std::cout << "   - Ciudad de nacimiento: " << ciudadNacimiento << "\n";
-    std::cout << "   - Fecha de nacimiento: " << fechaNacimiento << "\n\n";
-    std::cout << std::fixed << std::setprecision(2); // Formato de números
-    std::cout << "   - Ingresos anuales: $" << ingresosAnuales << "\n";
-    std::cout << "   - Patrimonio: $" << patrimonio << "\n";
-    std::cout << "   - Deudas: $" << deudas << "\n";
-    std::cout << "   - Declarante de renta: " << (declaranteRenta ? "Sí" : "No") << "\n";
+    PersonaRef(*this).mostrar();
 }
 
 /**
  * Implementación de mostrarResumen.
  * 
  * POR QUÉ: Mostrar información esencial de la persona en una sola línea.
- * CÓMO: Imprime ID, nombre completo, ciudad e ingresos.
+ * CÓMO: Imprime ID, nombre completo, ciudad e ingresos a través de PersonaRef.
  * PARA QUÉ: Listados rápidos y eficientes.
  */
 void Persona::mostrarResumen() const {
-    std::cout << "[" << id << "] " << nombre << " " << apellido
-              << " | " << ciudadNacimiento 
-              << " | $" << std::fixed << std::setprecision(2) << ingresosAnuales;
+    PersonaRef(*this).mostrarResumen();
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #ifndef PERSONA_H
 #define PERSONA_H
 
+#include "diccionario.h"
+#include "fecha.h"
+#include <cstdint>
 #include <string>
 #include <iostream>
 #include <iomanip>
@@ -14,39 +17,72 @@
  */
 class Persona {
 private:
-    std::string nombre;           // Nombre de pila
-    std::string apellido;         // Apellidos
+    // nombre, apellido y ciudad se guardan como códigos del Diccionario global:
+    // toman pocos valores distintos y así no ocupan un std::string por persona.
+    uint32_t nombre;              // Código del nombre de pila
+    uint32_t apellido;            // Código de los apellidos
+    uint32_t ciudadNacimiento;    // Código de la ciudad de nacimiento
     std::string id;               // Identificador único (cédula)
-    std::string ciudadNacimiento; // Ciudad de nacimiento
-    std::string fechaNacimiento;  // Fecha de nacimiento en formato DD/MM/AAAA
+    Fecha fechaNacimiento;        // Fecha de nacimiento empaquetada (el texto se arma al mostrar)
     double ingresosAnuales;       // Ingresos anuales en pesos colombianos
     double patrimonio;            // Patrimonio total (activos)
     double deudas;                // Deudas totales (pasivos)
     bool declaranteRenta;         // Si es declarante de renta
 
 public:
+    /**
+     * Constructor por defecto (persona vacía).
+     * 
+     * POR QUÉ: Permitir vectores pre-dimensionados que se llenan por posición.
+     * CÓMO: Strings vacíos y valores numéricos en cero.
+     * PARA QUÉ: Que varios hilos escriban cada uno en su propio tramo del vector.
+     */
+    Persona() : nombre(0), apellido(0), ciudadNacimiento(0),
+                ingresosAnuales(0), patrimonio(0), deudas(0), declaranteRenta(false) {}
+    
     /**
      * Constructor para inicializar todos los atributos de la persona.
      * 
      * POR QUÉ: Necesidad de crear instancias de Persona con todos sus datos.
-     * CÓMO: Recibe cada atributo por valor y los mueve a los miembros correspondientes.
+     * CÓMO: Recibe cada atributo por valor; nombre, apellido y ciudad se internan
+     *       en el Diccionario global, la fecha "D/M/AAAA" se empaqueta y el id se mueve.
      * PARA QUÉ: Construir objetos Persona completos y válidos.
      */
     Persona(std::string nom, std::string ape, std::string id, 
             std::string ciudad, std::string fecha, double ingresos, 
             double patri, double deud, bool declara);
     
+    /**
+     * Constructor con nombre, apellido y ciudad ya internados.
+     * 
+     * POR QUÉ: Los generadores eligen de vocabularios fijos cuyos códigos se conocen de antemano.
+     * CÓMO: Copia los códigos sin consultar el diccionario; la fecha ya viene empaquetada.
+     * PARA QUÉ: Crear personas sin hash ni asignaciones para esos cuatro campos.
+     */
+    Persona(uint32_t codNombre, uint32_t codApellido, std::string id,
+            uint32_t codCiudad, Fecha fecha, double ingresos,
+            double patri, double deud, bool declara);
+    
     // Métodos de acceso (getters) - Implementados inline para eficiencia
-    std::string getNombre() const { return nombre; }
-    std::string getApellido() const { return apellido; }
-    std::string getId() const { return id; }
-    std::string getCiudadNacimiento() const { return ciudadNacimiento; }
-    std::string getFechaNacimiento() const { return fechaNacimiento; }
+    // Los textos se devuelven por referencia (sin copia); los internados apuntan al diccionario.
+    const std::string& getNombre() const { return Diccionario::global().texto(nombre); }
+    const std::string& getApellido() const { return Diccionario::global().texto(apellido); }
+    const std::string& getId() const { return id; }
+    const std::string& getCiudadNacimiento() const { return Diccionario::global().texto(ciudadNacimiento); }
+    uint32_t getCodigoNombre() const { return nombre; }
+    uint32_t getCodigoApellido() const { return apellido; }
+    uint32_t getCodigoCiudad() const { return ciudadNacimiento; }
+    Fecha getFechaNacimiento() const { return fechaNacimiento; }
     double getIngresosAnuales() const { return ingresosAnuales; }
     double getPatrimonio() const { return patrimonio; }
     double getDeudas() const { return deudas; }
     bool getDeclaranteRenta() const { return declaranteRenta; }
 
+    // Actualización en sitio de los campos numéricos (los índices se ajustan aparte)
+    void setIngresosAnuales(double valor) { ingresosAnuales = valor; }
+    void setPatrimonio(double valor) { patrimonio = valor; }
+    void setDeudas(double valor) { deudas = valor; }
+
     /**
      * Muestra toda la información de la persona de forma detallada.
      * 
@@ -0,0 +1,28 @@
+#include "persona_ref.h"
+#include <iomanip>  // std::setprecision
+#include <iostream>
+
+/**
+ * Implementación de mostrar.
+ *
+ * POR QUÉ: Persona e InstantaneaMapeada::Vista tenían cada una su copia de este formato.
+ * CÓMO: Imprime los campos de la vista con flujos de salida.
+ * PARA QUÉ: Un solo formato de detalle para todos los almacenamientos.
+ */
+void PersonaRef::mostrar() const {
+    std::cout << "-------------------------------------\n";
+    std::cout << "[" << vId << "] Nombre: " << vNombre << " " << vApellido << "\n";
+    std::cout << "   - Ciudad de nacimiento: " << vCiudad << "\n";
+    std::cout << "   - Fecha de nacimiento: " << vFecha << "\n\n";
+    std::cout << std::fixed << std::setprecision(2); // Formato de números
+    std::cout << "   - Ingresos anuales: $" << vIngresos << "\n";
+    std::cout << "   - Patrimonio: $" << vPatrimonio << "\n";
+    std::cout << "   - Deudas: $" << vDeudas << "\n";
+    std::cout << "   - Declarante de renta: " << (vDeclarante ? "Sí" : "No") << "\n";
+}
+
+void PersonaRef::mostrarResumen() const {
+    std::cout << "[" << vId << "] " << vNombre << " " << vApellido
+              << " | " << vCiudad
+              << " | $" << std::fixed << std::setprecision(2) << vIngresos;
+}
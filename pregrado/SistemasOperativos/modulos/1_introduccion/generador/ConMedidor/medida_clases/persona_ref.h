@@ -0,0 +1,75 @@
+#ifndef PERSONA_REF_H
+#define PERSONA_REF_H
+
+#include "persona.h"
+#include "instantanea.h"
+#include <string_view>
+
+/**
+ * Vista de solo lectura de una persona, independiente de dónde esté guardada.
+ *
+ * POR QUÉ: Cada almacenamiento expone los campos a su manera (getters de Persona,
+ *          Vista de la instantánea) y el código de consulta terminaba duplicado
+ *          para cada uno.
+ * CÓMO: Guarda string_view a los textos y copia la fecha y los valores numéricos;
+ *       se construye implícitamente desde Persona o InstantaneaMapeada::Vista.
+ * PARA QUÉ: Escribir una sola vez las consultas y la visualización, sin copiar
+ *           strings ni asignar memoria.
+ *
+ * Los textos apuntan al registro de origen (o al Diccionario): la vista no debe
+ * sobrevivir al registro del que se tomó. Con ColeccionVirtual, cuyo operator[]
+ * devuelve una Persona temporal, úsese solo dentro de la misma expresión.
+ */
+class PersonaRef {
+public:
+    PersonaRef(const Persona& p)
+        : vNombre(p.getNombre()), vApellido(p.getApellido()), vId(p.getId()),
+          vCiudad(p.getCiudadNacimiento()), vFecha(p.getFechaNacimiento()),
+          vIngresos(p.getIngresosAnuales()), vPatrimonio(p.getPatrimonio()),
+          vDeudas(p.getDeudas()), vDeclarante(p.getDeclaranteRenta()) {}
+
+    PersonaRef(const InstantaneaMapeada::Vista& v)
+        : vNombre(v.nombre()), vApellido(v.apellido()), vId(v.id()),
+          vCiudad(v.ciudadNacimiento()), vFecha(v.fechaNacimiento()),
+          vIngresos(v.ingresosAnuales()), vPatrimonio(v.patrimonio()),
+          vDeudas(v.deudas()), vDeclarante(v.declaranteRenta()) {}
+
+    std::string_view nombre() const { return vNombre; }
+    std::string_view apellido() const { return vApellido; }
+    std::string_view id() const { return vId; }
+    std::string_view ciudadNacimiento() const { return vCiudad; }
+    Fecha fechaNacimiento() const { return vFecha; }
+    double ingresosAnuales() const { return vIngresos; }
+    double patrimonio() const { return vPatrimonio; }
+    double deudas() const { return vDeudas; }
+    bool declaranteRenta() const { return vDeclarante; }
+
+    void mostrar() const;        // Detalle completo en varias líneas
+    void mostrarResumen() const; // Una línea: ID, nombre, ciudad e ingresos
+
+private:
+    std::string_view vNombre, vApellido, vId, vCiudad;
+    Fecha vFecha;
+    double vIngresos, vPatrimonio, vDeudas;
+    bool vDeclarante;
+};
+
+/**
+ * Búsqueda lineal por ID sobre cualquier colección con size() y operator[]
+ * cuyos elementos se conviertan a PersonaRef.
+ *
+ * PARA QUÉ: Una sola implementación para el vector de Persona, la instantánea
+ *           y cualquier almacenamiento futuro; compara string_view sin copiar.
+ * @return Posición encontrada o -1.
+ */
+template <typename Coleccion>
+long buscarPosicionPorID(const Coleccion& coleccion, std::string_view id) {
+    for (size_t i = 0; i < coleccion.size(); ++i) {
+        if (PersonaRef(coleccion[i]).id() == id) {
+            return static_cast<long>(i);
+        }
+    }
+    return -1;
+}
+
+#endif // PERSONA_REF_H
@@ -0,0 +1,57 @@
+#ifndef PUBLICACION_H
+#define PUBLICACION_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+/**
+ * Versión publicada de un dato inmutable, al estilo RCU (read-copy-update).
+ *
+ * POR QUÉ: Reemplazar la colección en sitio obliga a que nadie la lea mientras
+ *          se construye la nueva.
+ * CÓMO: La versión vigente es un std::shared_ptr<const T>. Un lector la toma con
+ *       una carga atómica y la conserva mientras dure su consulta; el escritor
+ *       construye la versión nueva aparte y la publica con un intercambio atómico.
+ *       La cuenta de referencias hace de época: la versión vieja vive hasta que la
+ *       suelta su último lector.
+ * PARA QUÉ: Los lectores nunca esperan al escritor y siempre ven una versión
+ *           completa y coherente (la vieja o la nueva, nunca una mezcla).
+ */
+template <typename T>
+class Publicacion {
+public:
+    // Versión vigente; sigue siendo válida aunque se publique otra mientras se usa
+    std::shared_ptr<const T> leer() const {
+        return std::atomic_load_explicit(&actual, std::memory_order_acquire);
+    }
+
+    /**
+     * Publica una versión nueva.
+     *
+     * @return La versión anterior, para que el escritor la libere con retirar()
+     *         y el costo de destruirla no caiga en la consulta de un lector.
+     */
+    std::shared_ptr<const T> publicar(std::shared_ptr<const T> nueva) {
+        return std::atomic_exchange_explicit(&actual, std::move(nueva), std::memory_order_acq_rel);
+    }
+
+    /**
+     * Espera a que ningún lector use 'anterior' y la libera en este hilo.
+     *
+     * CÓMO: Ya no está publicada, así que nadie nuevo puede tomarla; cuando la
+     *       cuenta llega a 1 solo queda la referencia del escritor.
+     */
+    static void retirar(std::shared_ptr<const T>& anterior) {
+        while (anterior && anterior.use_count() > 1) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        anterior.reset();
+    }
+
+private:
+    std::shared_ptr<const T> actual;
+};
+
+#endif // PUBLICACION_H
@@ -0,0 +1,202 @@
+#include "regeneracion.h"
+#include "generador.h"
+#include "publicacion.h"
+#include <algorithm>    // std::max, std::min
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>        // std::unique_lock
+#include <random>
+#include <shared_mutex>
+#include <thread>
+
+namespace {
+
+// Pausa antes y después de regenerar, para medir las fases sin regeneración
+const auto PAUSA = std::chrono::milliseconds(300);
+
+/**
+ * Histograma logarítmico de latencias en ns.
+ *
+ * POR QUÉ: Guardar cada latencia ocuparía cientos de MB en unos segundos.
+ * CÓMO: 8 cubetas por potencia de 2 (error relativo <= 12.5%); los percentiles
+ *       se reportan con el límite superior de su cubeta.
+ */
+struct Histograma {
+    static constexpr int SUB = 8;
+    std::array<uint64_t, 64 * SUB> cubetas{};
+    uint64_t total = 0;
+    uint64_t maximo = 0;
+
+    static size_t cubeta(uint64_t ns) {
+        if (ns < SUB) {
+            return static_cast<size_t>(ns);
+        }
+        int exponente = 63 - __builtin_clzll(ns); // >= 3
+        return static_cast<size_t>((exponente - 2) * SUB + ((ns >> (exponente - 3)) & (SUB - 1)));
+    }
+
+    static uint64_t limiteSuperior(size_t c) {
+        if (c < SUB) {
+            return c;
+        }
+        int exponente = static_cast<int>(c / SUB) + 2;
+        uint64_t inferior = (SUB + c % SUB) << (exponente - 3);
+        return inferior + (uint64_t{1} << (exponente - 3)) - 1;
+    }
+
+    void agregar(uint64_t ns) {
+        ++cubetas[cubeta(ns)];
+        ++total;
+        maximo = std::max(maximo, ns);
+    }
+
+    void sumar(const Histograma& otro) {
+        for (size_t c = 0; c < cubetas.size(); ++c) {
+            cubetas[c] += otro.cubetas[c];
+        }
+        total += otro.total;
+        maximo = std::max(maximo, otro.maximo);
+    }
+
+    uint64_t percentil(double p) const {
+        uint64_t objetivo = static_cast<uint64_t>(p * static_cast<double>(total));
+        uint64_t acumulado = 0;
+        for (size_t c = 0; c < cubetas.size(); ++c) {
+            acumulado += cubetas[c];
+            if (acumulado > objetivo) {
+                return std::min(limiteSuperior(c), maximo);
+            }
+        }
+        return maximo;
+    }
+};
+
+std::shared_ptr<const ConjuntoPublicado> construirVersion(int n, uint64_t semilla, unsigned hilos,
+                                                          unsigned version) {
+    auto conjunto = std::make_shared<ConjuntoPublicado>();
+    conjunto->personas = generarColeccionParalela(n, semilla, hilos);
+    conjunto->indiceID.construir(conjunto->personas);
+    conjunto->version = version;
+    return conjunto;
+}
+
+// Consulta de un lector: la cédula de una fila al azar debe llevar a esa fila
+bool consultar(const ConjuntoPublicado& c, std::mt19937_64& motor) {
+    size_t fila = static_cast<size_t>(motor() % c.personas.size());
+    return c.indiceID.buscar(c.personas[fila].getId()) == static_cast<long>(fila);
+}
+
+} // namespace
+
+/**
+ * Implementación de regenerarConLectores.
+ *
+ * CÓMO: En modo Publicacion cada consulta toma la versión vigente con
+ *       Publicacion::leer(); el escritor construye sin cerrojos, publica y luego
+ *       retira la versión anterior (la destruye él, no un lector). En modo Cerrojo
+ *       los lectores toman un shared_lock y el escritor sostiene el unique_lock
+ *       durante toda la reconstrucción, como un reemplazo en sitio.
+ */
+ResultadoRegeneracion regenerarConLectores(int n, uint64_t semilla, unsigned hilos,
+                                           unsigned lectores, ModoRegeneracion modo) {
+    using Reloj = std::chrono::steady_clock;
+    auto msDesde = [](Reloj::time_point t) {
+        return std::chrono::duration<double, std::milli>(Reloj::now() - t).count();
+    };
+    ResultadoRegeneracion resultado;
+    const bool rcu = modo == ModoRegeneracion::Publicacion;
+
+    Publicacion<ConjuntoPublicado> publicacion;        // Modo RCU
+    std::shared_mutex cerrojo;                         // Modo cerrojo
+    std::shared_ptr<const ConjuntoPublicado> protegido; // Modo cerrojo (bajo 'cerrojo')
+    if (rcu) {
+        publicacion.publicar(construirVersion(n, semilla, hilos, 1));
+    } else {
+        protegido = construirVersion(n, semilla, hilos, 1);
+    }
+
+    std::atomic<int> fase(0);
+    std::atomic<bool> detener(false);
+    std::vector<std::array<Histograma, 3>> histogramas(lectores);
+    std::vector<uint64_t> errores(lectores, 0);
+
+    auto lector = [&](unsigned h) {
+        std::mt19937_64 motor(h + 1);
+        std::array<Histograma, 3> local;
+        uint64_t fallos = 0;
+        while (!detener.load(std::memory_order_relaxed)) {
+            int f = fase.load(std::memory_order_acquire);
+            auto inicio = Reloj::now();
+            bool ok;
+            if (rcu) {
+                std::shared_ptr<const ConjuntoPublicado> version = publicacion.leer();
+                ok = consultar(*version, motor);
+            } else {
+                std::shared_lock<std::shared_mutex> lectura(cerrojo);
+                ok = consultar(*protegido, motor);
+            }
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Reloj::now() - inicio).count();
+            local[f].agregar(static_cast<uint64_t>(ns));
+            fallos += !ok;
+        }
+        histogramas[h] = local; // Cada hilo escribe solo su ranura
+        errores[h] = fallos;
+    };
+
+    std::vector<std::thread> grupo;
+    for (unsigned h = 0; h < lectores; ++h) {
+        grupo.emplace_back(lector, h);
+    }
+
+    // Fase 0: solo lectores
+    auto inicioFase = Reloj::now();
+    std::this_thread::sleep_for(PAUSA);
+    resultado.fases[0].duracion = msDesde(inicioFase);
+
+    // Fase 1: regeneración
+    inicioFase = Reloj::now();
+    fase.store(1, std::memory_order_release);
+    std::shared_ptr<const ConjuntoPublicado> anterior;
+    if (rcu) {
+        auto nueva = construirVersion(n, semilla + 1, hilos, 2);
+        resultado.tiempoConstruccion = msDesde(inicioFase);
+        anterior = publicacion.publicar(std::move(nueva));
+    } else {
+        std::unique_lock<std::shared_mutex> escritura(cerrojo);
+        protegido = construirVersion(n, semilla + 1, hilos, 2);
+        resultado.tiempoConstruccion = msDesde(inicioFase);
+    }
+    resultado.fases[1].duracion = msDesde(inicioFase);
+
+    // Fase 2: lectores sobre la versión nueva; la anterior se libera al salir su último lector
+    inicioFase = Reloj::now();
+    fase.store(2, std::memory_order_release);
+    if (rcu) {
+        Publicacion<ConjuntoPublicado>::retirar(anterior);
+        resultado.tiempoLiberacion = msDesde(inicioFase);
+    }
+    std::this_thread::sleep_for(PAUSA);
+    detener.store(true, std::memory_order_relaxed);
+    for (auto& t : grupo) {
+        t.join();
+    }
+    resultado.fases[2].duracion = msDesde(inicioFase);
+
+    for (int f = 0; f < 3; ++f) {
+        Histograma total;
+        for (const auto& h : histogramas) {
+            total.sumar(h[f]);
+        }
+        LatenciaFase& l = resultado.fases[f];
+        l.consultas = total.total;
+        l.p50 = total.percentil(0.50);
+        l.p99 = total.percentil(0.99);
+        l.p999 = total.percentil(0.999);
+        l.maximo = total.maximo;
+    }
+    for (uint64_t e : errores) {
+        resultado.errores += e;
+    }
+    return resultado;
+}
@@ -0,0 +1,58 @@
+#ifndef REGENERACION_H
+#define REGENERACION_H
+
+#include "persona.h"
+#include "indice_id.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * Versión inmutable de la colección que consultan los lectores.
+ */
+struct ConjuntoPublicado {
+    std::vector<Persona> personas;
+    IndiceID indiceID;
+    unsigned version = 0;
+};
+
+/**
+ * Cómo conviven los lectores con la regeneración.
+ */
+enum class ModoRegeneracion {
+    Publicacion, // RCU: se construye aparte y se publica con un intercambio atómico
+    Cerrojo      // Referencia: cerrojo exclusivo mientras se reconstruye en sitio
+};
+
+/**
+ * Latencias de consulta de una fase (antes, durante o después de regenerar).
+ */
+struct LatenciaFase {
+    uint64_t consultas = 0;
+    double duracion = 0.0; // ms de pared de la fase
+    uint64_t p50 = 0, p99 = 0, p999 = 0, maximo = 0; // ns
+};
+
+struct ResultadoRegeneracion {
+    LatenciaFase fases[3];         // 0 = antes, 1 = durante, 2 = después
+    double tiempoConstruccion = 0; // ms para generar e indexar la versión nueva
+    double tiempoLiberacion = 0;   // ms desde publicar hasta liberar la versión anterior
+    uint64_t errores = 0;          // Consultas que no encontraron la fila esperada
+};
+
+/**
+ * Regenera la colección mientras varios hilos la consultan.
+ *
+ * POR QUÉ: Medir si las consultas se detienen mientras se construye una colección
+ *          nueva, comparando publicación RCU contra un cerrojo exclusivo.
+ * CÓMO: Publica la versión 1 (semilla), lanza 'lectores' hilos que buscan por ID
+ *       filas al azar y anotan cada latencia en un histograma por fase; tras una
+ *       pausa el hilo principal construye la versión 2 (semilla + 1) y la instala
+ *       según el modo; tras otra pausa detiene a los lectores.
+ * PARA QUÉ: Latencias p50/p99/p99.9/máximo antes, durante y después de regenerar.
+ *
+ * @param hilos Hilos para generar la versión nueva (0 = todos los núcleos).
+ */
+ResultadoRegeneracion regenerarConLectores(int n, uint64_t semilla, unsigned hilos,
+                                           unsigned lectores, ModoRegeneracion modo);
+
+#endif // REGENERACION_H
@@ -0,0 +1,70 @@
+#include "salida_listado.h"
+#include <charconv>  // std::to_chars
+#include <cstdio>    // std::fflush
+#include <iostream>
+#include <unistd.h>  // write
+
+EscritorListado::EscritorListado(int fd, size_t capacidad) : fd(fd), capacidad(capacidad) {
+    bufer.reserve(capacidad + 512);
+    // Lo que std::cout tenga pendiente debe salir antes que este listado
+    std::cout.flush();
+    std::fflush(stdout);
+}
+
+EscritorListado::~EscritorListado() {
+    vaciar();
+}
+
+/**
+ * Implementación de agregarResumen.
+ *
+ * CÓMO: "fila. [id] nombre apellido | ciudad | $ingresos\n"; los números se
+ *       escriben con std::to_chars directamente en un arreglo local.
+ */
+void EscritorListado::agregarResumen(size_t fila, const PersonaRef& p) {
+    char numero[64];
+    auto resultado = std::to_chars(numero, numero + sizeof(numero), fila);
+    bufer.append(numero, resultado.ptr);
+    bufer += ". [";
+    bufer += p.id();
+    bufer += "] ";
+    bufer += p.nombre();
+    bufer += ' ';
+    bufer += p.apellido();
+    bufer += " | ";
+    bufer += p.ciudadNacimiento();
+    bufer += " | $";
+    resultado = std::to_chars(numero, numero + sizeof(numero), p.ingresosAnuales(),
+                              std::chars_format::fixed, 2);
+    bufer.append(numero, resultado.ptr);
+    bufer += '\n';
+    if (bufer.size() >= capacidad) {
+        vaciar();
+    }
+}
+
+void EscritorListado::agregar(std::string_view texto) {
+    bufer += texto;
+    if (bufer.size() >= capacidad) {
+        vaciar();
+    }
+}
+
+bool EscritorListado::vaciar() {
+    // Reintenta escrituras parciales (p. ej. tuberías llenas)
+    const char* datos = bufer.data();
+    size_t restante = bufer.size();
+    bool ok = true;
+    while (restante > 0) {
+        ssize_t n = write(fd, datos, restante);
+        if (n <= 0) {
+            ok = false;
+            break;
+        }
+        datos += n;
+        restante -= static_cast<size_t>(n);
+        escritos += static_cast<unsigned long long>(n);
+    }
+    bufer.clear();
+    return ok;
+}
@@ -0,0 +1,54 @@
+#ifndef SALIDA_LISTADO_H
+#define SALIDA_LISTADO_H
+
+#include "persona_ref.h"
+#include <string>
+#include <string_view>
+
+/**
+ * Escritor de listados con búfer propio.
+ *
+ * POR QUÉ: mostrarResumen hace seis o más operator<< por registro, con
+ *          std::fixed/std::setprecision y la sincronización de std::cout; listar
+ *          un millón de personas tarda más que generarlas.
+ * CÓMO: Cada línea se arma en un búfer grande reutilizado (montos con
+ *       std::to_chars, textos con append) y el búfer se vacía con write(2)
+ *       cuando se llena, al llamar a vaciar() y al destruir el escritor.
+ * PARA QUÉ: Listados limitados por la terminal o el disco, no por el formateo.
+ *
+ * Las líneas tienen el mismo formato que "fila. " + mostrarResumen().
+ */
+class EscritorListado {
+public:
+    /**
+     * @param fd Descriptor de salida (por defecto la salida estándar).
+     * @param capacidad Bytes acumulados antes de escribir.
+     */
+    explicit EscritorListado(int fd = 1, size_t capacidad = 1 << 20);
+    ~EscritorListado();
+    EscritorListado(const EscritorListado&) = delete;
+    EscritorListado& operator=(const EscritorListado&) = delete;
+
+    // Agrega la línea de resumen de una persona (de cualquier almacenamiento) precedida por su fila
+    void agregarResumen(size_t fila, const PersonaRef& p);
+
+    // Agrega texto libre
+    void agregar(std::string_view texto);
+
+    /**
+     * Escribe lo acumulado.
+     * @return false si write(2) falló.
+     */
+    bool vaciar();
+
+    // Bytes entregados a write(2) desde la creación
+    unsigned long long bytes() const { return escritos; }
+
+private:
+    int fd;
+    size_t capacidad;
+    std::string bufer;
+    unsigned long long escritos = 0;
+};
+
+#endif // SALIDA_LISTADO_H
@@ -0,0 +1,134 @@
+#include "top_k.h"
+#include <algorithm> // std::push_heap, std::pop_heap, std::partial_sort
+#include <atomic>
+#include <limits>
+#include <thread>
+
+double valorMetrica(const Persona& p, MetricaTopK metrica) {
+    switch (metrica) {
+        case MetricaTopK::PatrimonioNeto: return p.getPatrimonio() - p.getDeudas();
+        case MetricaTopK::Ingresos: return p.getIngresosAnuales();
+        case MetricaTopK::Patrimonio: return p.getPatrimonio();
+        case MetricaTopK::Deudas: return p.getDeudas();
+        case MetricaTopK::RazonDeudaIngreso: break;
+    }
+    if (p.getIngresosAnuales() > 0) {
+        return p.getDeudas() / p.getIngresosAnuales();
+    }
+    return p.getDeudas() > 0 ? std::numeric_limits<double>::infinity() : 0.0;
+}
+
+const char* nombreMetrica(MetricaTopK metrica) {
+    switch (metrica) {
+        case MetricaTopK::PatrimonioNeto: return "Patrimonio neto";
+        case MetricaTopK::Ingresos: return "Ingresos anuales";
+        case MetricaTopK::Patrimonio: return "Patrimonio";
+        case MetricaTopK::Deudas: return "Deudas";
+        case MetricaTopK::RazonDeudaIngreso: break;
+    }
+    return "Razón deuda/ingreso";
+}
+
+/**
+ * Implementación de topK.
+ *
+ * POR QUÉ: Seleccionar sin ordenar la colección completa.
+ * CÓMO: Montículo con comparador mejorEntrada: la cima es la peor de las k
+ *       mejores vistas. Mientras no hay k entradas se inserta siempre; después
+ *       solo si la fila es mejor que la cima (la cima se reemplaza).
+ * PARA QUÉ: La inmensa mayoría de filas se descarta con una sola comparación.
+ */
+std::vector<EntradaTopK> topK(const std::vector<Persona>& personas, size_t k,
+                              MetricaTopK metrica, unsigned hilos, const MapaBajas* bajas) {
+    const size_t BLOQUE = 1 << 16; // Filas por bloque de trabajo
+    const size_t total = personas.size();
+    k = std::min(k, total);
+    if (k == 0) {
+        return {};
+    }
+    if (hilos == 0) {
+        hilos = std::max(1u, std::thread::hardware_concurrency());
+    }
+    // Más hilos que bloques solo agregarían montículos vacíos
+    hilos = static_cast<unsigned>(std::min<size_t>(hilos, (total + BLOQUE - 1) / BLOQUE));
+
+    std::vector<std::vector<EntradaTopK>> parciales(hilos);
+    std::atomic<size_t> siguienteBloque(0);
+
+    auto trabajador = [&](unsigned h) {
+        std::vector<EntradaTopK> monticulo;
+        monticulo.reserve(std::min(k, BLOQUE)); // Con k grande crece solo si el hilo ve más filas
+        for (;;) {
+            size_t desde = siguienteBloque.fetch_add(BLOQUE);
+            if (desde >= total) {
+                break;
+            }
+            size_t hasta = std::min(desde + BLOQUE, total);
+            for (size_t i = desde; i < hasta; ++i) {
+                if (bajas && bajas->eliminada(i)) {
+                    continue;
+                }
+                EntradaTopK candidata{static_cast<uint32_t>(i), valorMetrica(personas[i], metrica)};
+                if (monticulo.size() < k) {
+                    monticulo.push_back(candidata);
+                    std::push_heap(monticulo.begin(), monticulo.end(), mejorEntrada);
+                } else if (mejorEntrada(candidata, monticulo.front())) {
+                    std::pop_heap(monticulo.begin(), monticulo.end(), mejorEntrada);
+                    monticulo.back() = candidata;
+                    std::push_heap(monticulo.begin(), monticulo.end(), mejorEntrada);
+                }
+            }
+        }
+        parciales[h] = std::move(monticulo); // Cada hilo escribe solo su ranura
+    };
+
+    std::vector<std::thread> grupo;
+    for (unsigned h = 1; h < hilos; ++h) {
+        grupo.emplace_back(trabajador, h);
+    }
+    trabajador(0); // El hilo principal también trabaja
+    for (auto& t : grupo) {
+        t.join();
+    }
+
+    // Fusión: a lo sumo hilos * k candidatas; se ordenan y se conservan k
+    size_t numCandidatas = 0;
+    for (const auto& parcial : parciales) {
+        numCandidatas += parcial.size();
+    }
+    std::vector<EntradaTopK> candidatas;
+    candidatas.reserve(numCandidatas);
+    for (const auto& parcial : parciales) {
+        candidatas.insert(candidatas.end(), parcial.begin(), parcial.end());
+    }
+    k = std::min(k, candidatas.size()); // Con filas eliminadas puede haber menos de k
+    std::partial_sort(candidatas.begin(), candidatas.begin() + k, candidatas.end(), mejorEntrada);
+    candidatas.resize(k);
+    return candidatas;
+}
+
+std::vector<EntradaTopK> topKOrdenamientoParcial(const std::vector<Persona>& personas, size_t k,
+                                                 MetricaTopK metrica, const MapaBajas* bajas) {
+    // Vistas por índice sobre los registros: el comparador lee cada Persona,
+    // como lo haría un std::partial_sort directo sobre la colección
+    std::vector<uint32_t> filas;
+    filas.reserve(personas.size());
+    for (size_t i = 0; i < personas.size(); ++i) {
+        if (!(bajas && bajas->eliminada(i))) {
+            filas.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    auto mejorFila = [&](uint32_t a, uint32_t b) {
+        return mejorEntrada({a, valorMetrica(personas[a], metrica)},
+                            {b, valorMetrica(personas[b], metrica)});
+    };
+    k = std::min(k, filas.size());
+    std::partial_sort(filas.begin(), filas.begin() + k, filas.end(), mejorFila);
+
+    std::vector<EntradaTopK> entradas;
+    entradas.reserve(k);
+    for (size_t pos = 0; pos < k; ++pos) {
+        entradas.push_back({filas[pos], valorMetrica(personas[filas[pos]], metrica)});
+    }
+    return entradas;
+}
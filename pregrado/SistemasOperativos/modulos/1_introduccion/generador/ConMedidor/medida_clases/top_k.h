@@ -0,0 +1,72 @@
+#ifndef TOP_K_H
+#define TOP_K_H
+
+#include "persona.h"
+#include "mapa_bajas.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * Métricas por las que se puede ordenar el Top-K.
+ */
+enum class MetricaTopK {
+    PatrimonioNeto,     // patrimonio - deudas
+    Ingresos,           // ingresosAnuales
+    Patrimonio,         // patrimonio
+    Deudas,             // deudas
+    RazonDeudaIngreso   // deudas / ingresosAnuales
+};
+
+// Valor de la métrica para una persona (la razón con ingresos 0 vale infinito si hay deuda)
+double valorMetrica(const Persona& p, MetricaTopK metrica);
+
+// Nombre legible de la métrica
+const char* nombreMetrica(MetricaTopK metrica);
+
+/**
+ * Una posición del Top-K.
+ */
+struct EntradaTopK {
+    uint32_t fila;  // Fila en la colección
+    double valor;   // Valor de la métrica
+};
+
+/**
+ * Orden del Top-K: mayor valor primero y, a igual valor, la fila menor.
+ *
+ * PARA QUÉ: Que el resultado sea único y comparable entre métodos e hilos.
+ */
+inline bool mejorEntrada(const EntradaTopK& a, const EntradaTopK& b) {
+    return a.valor > b.valor || (a.valor == b.valor && a.fila < b.fila);
+}
+
+/**
+ * Las k personas con mayor valor de la métrica.
+ *
+ * POR QUÉ: Ordenar toda la colección para quedarse con 100 filas es O(n log n)
+ *          y mueve todos los registros.
+ * CÓMO: Cada hilo toma bloques de filas de un contador atómico y mantiene un
+ *       montículo acotado de k entradas cuya cima es la peor; una fila solo entra
+ *       si supera esa cima. Al final se unen los montículos (hilos * k entradas)
+ *       y se ordenan.
+ * PARA QUÉ: O(n log k) con memoria O(hilos * k), sin tocar la colección.
+ *
+ * @param hilos Número de hilos (0 = todos los núcleos).
+ * @param bajas Filas eliminadas que se omiten (nullptr = ninguna).
+ * @return Hasta k entradas en orden (mejorEntrada).
+ */
+std::vector<EntradaTopK> topK(const std::vector<Persona>& personas, size_t k,
+                              MetricaTopK metrica, unsigned hilos,
+                              const MapaBajas* bajas = nullptr);
+
+/**
+ * Referencia: std::partial_sort sobre vistas por índice de los registros, con
+ * el mismo orden (mejorEntrada) y la métrica calculada en cada comparación.
+ *
+ * PARA QUÉ: Comparar tiempos contra lo que se haría sin topK y verificar que
+ *           topK da el mismo resultado.
+ */
+std::vector<EntradaTopK> topKOrdenamientoParcial(const std::vector<Persona>& personas, size_t k,
+                                                 MetricaTopK metrica, const MapaBajas* bajas = nullptr);
+
+#endif // TOP_K_H
@@ -0,0 +1,196 @@
+#ifndef BANCO_H
+#define BANCO_H
+
+#include "fuente_datos.h"
+#include "../medida_clases/contador_asignaciones.h"
+#include <chrono>
+#include <cstdio>       // std::printf, std::fopen
+#include <cstdlib>      // std::strtol
+#include <string>
+#include <string_view>
+#include <vector>
+#include <sys/resource.h> // getrusage
+#include <unistd.h>       // sysconf
+
+// Colección de personas con la representación elegida en compilación.
+//
+// Una Disposicion es un tipo con solo miembros estáticos:
+//   nombre                    Texto corto que identifica la disposición
+//   Almacen                   Tipo que guarda la colección
+//   reservar(a, n)            Reserva espacio para n personas
+//   agregar(a, campos)        Copia una persona a la representación
+//   tam(a)                    Número de personas
+//   id(a, i)                  ID de la fila i
+//   fila(a, i)                Todos los campos de la fila i (textos dentro del almacén)
+//   ingresos / patrimonio / deudas / declarante (a, i)
+// Las cargas de trabajo solo usan esta interfaz, así que son idénticas en todas.
+template <typename Disposicion>
+class Coleccion {
+public:
+    static const char* nombre() { return Disposicion::nombre; }
+
+    void reservar(size_t n) { Disposicion::reservar(almacen, n); }
+    void agregar(const CamposPersona& campos) { Disposicion::agregar(almacen, campos); }
+    size_t size() const { return Disposicion::tam(almacen); }
+
+    std::string_view id(size_t i) const { return Disposicion::id(almacen, i); }
+    CamposPersona fila(size_t i) const { return Disposicion::fila(almacen, i); }
+    double ingresos(size_t i) const { return Disposicion::ingresos(almacen, i); }
+    double patrimonio(size_t i) const { return Disposicion::patrimonio(almacen, i); }
+    double deudas(size_t i) const { return Disposicion::deudas(almacen, i); }
+    bool declarante(size_t i) const { return Disposicion::declarante(almacen, i); }
+
+private:
+    typename Disposicion::Almacen almacen;
+};
+
+// Resultado de una carga de trabajo
+struct Medicion {
+    double ms = 0;                      // Tiempo de pared
+    long kb = 0;                        // Variación del RSS
+    unsigned long long asignaciones = 0; // Llamadas a operator new
+    std::string control;                // Valor que debe coincidir entre disposiciones
+};
+
+// RSS actual en KB (segundo campo de /proc/self/statm)
+inline long memoriaResidenteKB() {
+    long tam = 0, residente = 0;
+    if (FILE* archivo = std::fopen("/proc/self/statm", "r")) {
+        if (std::fscanf(archivo, "%ld %ld", &tam, &residente) != 2) {
+            residente = 0;
+        }
+        std::fclose(archivo);
+    }
+    return residente * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+// Mide tiempo, RSS y asignaciones de 'carga', que devuelve el valor de control
+template <typename Carga>
+Medicion medir(Carga carga) {
+    Medicion m;
+    long memoriaAntes = memoriaResidenteKB();
+    auto inicio = std::chrono::steady_clock::now();
+    iniciarConteoAsignaciones();
+    m.control = carga();
+    m.asignaciones = detenerConteoAsignaciones();
+    m.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+    m.kb = memoriaResidenteKB() - memoriaAntes;
+    return m;
+}
+
+// --- Cargas de trabajo ---
+
+// Generación: n personas de la fuente común copiadas a la disposición
+template <typename Disposicion>
+std::string cargaGenerar(Coleccion<Disposicion>& c, size_t n, unsigned semilla) {
+    FuenteDatos fuente(semilla);
+    c.reservar(n);
+    for (size_t i = 0; i < n; ++i) {
+        c.agregar(fuente.siguiente());
+    }
+    return std::to_string(c.size());
+}
+
+// Listado: la línea de resumen de cada persona se arma en un búfer de 1 MB que se
+// descarta al llenarse (mide el acceso y el formateo, no la terminal)
+template <typename Disposicion>
+std::string cargaListar(const Coleccion<Disposicion>& c) {
+    const size_t CAPACIDAD = 1 << 20;
+    std::string bufer;
+    bufer.reserve(CAPACIDAD + 512);
+    unsigned long long bytes = 0;
+    char numero[64];
+    for (size_t i = 0; i < c.size(); ++i) {
+        CamposPersona p = c.fila(i);
+        bufer += '[';
+        bufer += p.id;
+        bufer += "] ";
+        bufer += p.nombre;
+        bufer += ' ';
+        bufer += p.apellido;
+        bufer += " | ";
+        bufer += p.ciudadNacimiento;
+        bufer += " | $";
+        bufer.append(numero, std::to_chars(numero, numero + sizeof(numero), p.ingresosAnuales,
+                                           std::chars_format::fixed, 2).ptr);
+        bufer += '\n';
+        if (bufer.size() >= CAPACIDAD) {
+            bytes += bufer.size();
+            bufer.clear();
+        }
+    }
+    return std::to_string(bytes + bufer.size());
+}
+
+// Búsqueda: IDs existentes buscados con un recorrido lineal de la columna de IDs
+template <typename Disposicion>
+std::string cargaBuscar(const Coleccion<Disposicion>& c, const std::vector<std::string>& ids) {
+    unsigned long long sumaFilas = 0;
+    for (const auto& objetivo : ids) {
+        for (size_t i = 0; i < c.size(); ++i) {
+            if (c.id(i) == objetivo) {
+                sumaFilas += i;
+                break;
+            }
+        }
+    }
+    return std::to_string(sumaFilas);
+}
+
+// Agregación: totales financieros y número de declarantes en una pasada
+template <typename Disposicion>
+std::string cargaAgregar(const Coleccion<Disposicion>& c) {
+    double ingresos = 0, neto = 0;
+    size_t declarantes = 0;
+    for (size_t i = 0; i < c.size(); ++i) {
+        ingresos += c.ingresos(i);
+        neto += c.patrimonio(i) - c.deudas(i);
+        declarantes += c.declarante(i);
+    }
+    char texto[128];
+    std::snprintf(texto, sizeof(texto), "%.2f/%.2f/%zu", ingresos, neto, declarantes);
+    return texto;
+}
+
+/**
+ * Ejecuta todas las cargas sobre Coleccion<Disposicion> e imprime una línea por carga:
+ *   RESULTADO;disposicion;carga;ms;kb;asignaciones;control
+ *
+ * Argumentos: [n] [semilla] [búsquedas] (por defecto 1000000 42 20).
+ * Cada disposición corre en su propio proceso (ver comparar.cpp), así el RSS
+ * medido no incluye lo que dejó la anterior.
+ */
+template <typename Disposicion>
+int ejecutarBanco(int argc, char* argv[]) {
+    size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    unsigned semilla = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 42;
+    size_t busquedas = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 20;
+    if (n == 0) {
+        std::fprintf(stderr, "Uso: %s [n > 0] [semilla] [búsquedas]\n", argv[0]);
+        return 1;
+    }
+
+    // IDs a buscar: repartidos por toda la colección, preparados fuera de la medición
+    std::vector<std::string> ids;
+    for (size_t b = 0; b < busquedas; ++b) {
+        ids.push_back(std::to_string(FuenteDatos::ID_INICIAL + (b * 7919 + 13) * 104729 % n));
+    }
+
+    Coleccion<Disposicion> c;
+    auto imprimir = [](const char* carga, const Medicion& m) {
+        std::printf("RESULTADO;%s;%s;%.2f;%ld;%llu;%s\n", Coleccion<Disposicion>::nombre(), carga,
+                    m.ms, m.kb, m.asignaciones, m.control.c_str());
+    };
+    imprimir("generar", medir([&] { return cargaGenerar(c, n, semilla); }));
+    imprimir("listar", medir([&] { return cargaListar(c); }));
+    imprimir("buscar", medir([&] { return cargaBuscar(c, ids); }));
+    imprimir("agregar", medir([&] { return cargaAgregar(c); }));
+
+    // Pico de RSS de todo el proceso (ru_maxrss está en KB en Linux)
+    struct rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+    std::printf("RESULTADO;%s;pico_rss;0;%ld;0;-\n", Coleccion<Disposicion>::nombre(), uso.ru_maxrss);
+    return 0;
+}
+
+#endif // BANCO_H
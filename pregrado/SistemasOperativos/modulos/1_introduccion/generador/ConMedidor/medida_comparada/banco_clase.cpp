@@ -0,0 +1,6 @@
+#include "banco.h"
+#include "disposicion_clase.h"
+
+int main(int argc, char* argv[]) {
+    return ejecutarBanco<DisposicionClase>(argc, argv);
+}
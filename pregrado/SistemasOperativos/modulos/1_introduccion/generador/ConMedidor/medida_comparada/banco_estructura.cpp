@@ -0,0 +1,6 @@
+#include "banco.h"
+#include "disposicion_estructura.h"
+
+int main(int argc, char* argv[]) {
+    return ejecutarBanco<DisposicionEstructura>(argc, argv);
+}
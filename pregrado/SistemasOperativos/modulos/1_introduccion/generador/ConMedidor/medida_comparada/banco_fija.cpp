@@ -0,0 +1,6 @@
+#include "banco.h"
+#include "disposicion_fija.h"
+
+int main(int argc, char* argv[]) {
+    return ejecutarBanco<DisposicionFija>(argc, argv);
+}
@@ -0,0 +1,6 @@
+#include "banco.h"
+#include "disposicion_tabla.h"
+
+int main(int argc, char* argv[]) {
+    return ejecutarBanco<DisposicionTabla>(argc, argv);
+}
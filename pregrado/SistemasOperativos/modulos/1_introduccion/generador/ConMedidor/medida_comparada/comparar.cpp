@@ -0,0 +1,138 @@
+#include <cstdio>    // popen, pclose
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Disposiciones compiladas (las fija el makefile)
+#ifndef DISPOSICIONES
+#define DISPOSICIONES "clase estructura tabla fija"
+#endif
+
+namespace {
+
+// Una línea RESULTADO;disposicion;carga;ms;kb;asignaciones;control
+struct Fila {
+    double ms = 0;
+    long kb = 0;
+    unsigned long long asignaciones = 0;
+    std::string control;
+};
+
+const char* const CARGAS[] = {"generar", "listar", "buscar", "agregar", "pico_rss"};
+
+/**
+ * Ejecuta ./banco_<disposicion> y lee sus resultados.
+ *
+ * POR QUÉ: Cada disposición define su propio tipo Persona; en un mismo programa
+ *          chocarían, y además el RSS de una contaminaría la medición de la otra.
+ * CÓMO: popen del programa de la disposición y lectura de las líneas RESULTADO.
+ * PARA QUÉ: Una sola ejecución que compara todas las disposiciones.
+ * @return false si el programa no se pudo ejecutar o no terminó bien.
+ */
+bool ejecutar(const std::string& disposicion, const std::string& argumentos,
+              std::map<std::string, Fila>& resultados) {
+    std::string comando = "./banco_" + disposicion + " " + argumentos;
+    FILE* tuberia = popen(comando.c_str(), "r");
+    if (!tuberia) {
+        std::perror(("Error al ejecutar " + comando).c_str());
+        return false;
+    }
+    char linea[512];
+    while (std::fgets(linea, sizeof(linea), tuberia)) {
+        std::istringstream campos(linea);
+        std::string etiqueta, nombre, carga, ms, kb, asignaciones, control;
+        std::getline(campos, etiqueta, ';');
+        if (etiqueta != "RESULTADO") {
+            continue;
+        }
+        std::getline(campos, nombre, ';');
+        std::getline(campos, carga, ';');
+        std::getline(campos, ms, ';');
+        std::getline(campos, kb, ';');
+        std::getline(campos, asignaciones, ';');
+        std::getline(campos, control);
+        Fila& f = resultados[carga];
+        f.ms = std::stod(ms);
+        f.kb = std::stol(kb);
+        f.asignaciones = std::stoull(asignaciones);
+        f.control = control;
+    }
+    return pclose(tuberia) == 0 && !resultados.empty();
+}
+
+} // namespace
+
+/**
+ * Compara todas las disposiciones de Persona con las mismas cargas de trabajo.
+ *
+ * Uso: ./comparar [n] [semilla] [búsquedas]
+ * Imprime tres tablas (tiempo, variación de RSS, asignaciones) con una columna
+ * por disposición y verifica que todas den los mismos valores de control.
+ */
+int main(int argc, char* argv[]) {
+    std::string argumentos;
+    for (int i = 1; i < argc && i <= 3; ++i) {
+        argumentos += std::string(argv[i]) + " ";
+    }
+
+    std::vector<std::string> disposiciones;
+    std::istringstream lista(DISPOSICIONES);
+    for (std::string d; lista >> d;) {
+        disposiciones.push_back(d);
+    }
+
+    std::vector<std::map<std::string, Fila>> resultados(disposiciones.size());
+    for (size_t d = 0; d < disposiciones.size(); ++d) {
+        std::cout << "Ejecutando banco_" << disposiciones[d] << "...\n" << std::flush;
+        if (!ejecutar(disposiciones[d], argumentos, resultados[d])) {
+            std::cerr << "banco_" << disposiciones[d] << " falló\n";
+            return 1;
+        }
+    }
+
+    auto tabla = [&](const char* titulo, auto valor) {
+        std::cout << "\n=== " << titulo << " ===\n" << std::left << std::setw(10) << "Carga";
+        for (const auto& d : disposiciones) {
+            std::cout << std::right << std::setw(14) << d;
+        }
+        std::cout << "\n";
+        for (const char* carga : CARGAS) {
+            std::cout << std::left << std::setw(10) << carga;
+            for (auto& r : resultados) {
+                std::cout << std::right << std::setw(14) << valor(carga, r[carga]);
+            }
+            std::cout << "\n";
+        }
+    };
+
+    std::cout << std::fixed << std::setprecision(1);
+    tabla("TIEMPO (ms)", [](const std::string& carga, const Fila& f) {
+        std::ostringstream s;
+        if (carga == "pico_rss") {
+            s << "-";
+        } else {
+            s << std::fixed << std::setprecision(1) << f.ms;
+        }
+        return s.str();
+    });
+    tabla("MEMORIA (KB de RSS; pico_rss = máximo del proceso)", [](const std::string&, const Fila& f) {
+        return std::to_string(f.kb);
+    });
+    tabla("ASIGNACIONES (llamadas a operator new)", [](const std::string& carga, const Fila& f) {
+        return carga == "pico_rss" ? std::string("-") : std::to_string(f.asignaciones);
+    });
+
+    // Mismos datos y mismas cargas: los valores de control deben coincidir
+    bool iguales = true;
+    for (const char* carga : CARGAS) {
+        for (auto& r : resultados) {
+            iguales = iguales && r[carga].control == resultados[0][carga].control;
+        }
+    }
+    std::cout << "\nValores de control: "
+              << (iguales ? "iguales en todas las disposiciones\n" : "ERROR: difieren entre disposiciones\n");
+    return iguales ? 0 : 1;
+}
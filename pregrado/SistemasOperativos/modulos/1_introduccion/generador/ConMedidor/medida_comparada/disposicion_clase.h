@@ -0,0 +1,44 @@
+#ifndef DISPOSICION_CLASE_H
+#define DISPOSICION_CLASE_H
+
+#include "fuente_datos.h"
+#include "../medida_clases/diccionario.h"
+#include "../medida_clases/persona.h"
+#include <string>
+#include <vector>
+
+// Clase Persona de medida_clases: nombre, apellido y ciudad internados en el
+// Diccionario global (códigos de 32 bits), id como std::string y fecha
+// empaquetada en 32 bits (Fecha)
+struct DisposicionClase {
+    static constexpr const char* nombre = "clase";
+    using Almacen = std::vector<Persona>;
+
+    static void reservar(Almacen& a, size_t n) { a.reserve(n); }
+    // Los textos pasan por una CacheCodigos, como en el generador: el cerrojo del
+    // Diccionario global se toma una vez por texto distinto y no una vez por fila
+    static void agregar(Almacen& a, const CamposPersona& c) {
+        static thread_local CacheCodigos cache;
+        a.emplace_back(cache.internar(c.nombre), cache.internar(c.apellido), std::string(c.id),
+                       cache.internar(c.ciudadNacimiento), Fecha::desdeTexto(c.fechaNacimiento),
+                       c.ingresosAnuales, c.patrimonio, c.deudas, c.declaranteRenta);
+    }
+    static size_t tam(const Almacen& a) { return a.size(); }
+
+    static std::string_view id(const Almacen& a, size_t i) { return a[i].getId(); }
+    // La fecha se arma como texto en un búfer propio, válido hasta la siguiente
+    // llamada (igual que los textos de FuenteDatos::siguiente)
+    static CamposPersona fila(const Almacen& a, size_t i) {
+        static thread_local char fecha[Fecha::LARGO_MAXIMO];
+        const Persona& p = a[i];
+        return {p.getNombre(), p.getApellido(), p.getId(), p.getCiudadNacimiento(),
+                std::string_view(fecha, p.getFechaNacimiento().escribir(fecha)),
+                p.getIngresosAnuales(), p.getPatrimonio(), p.getDeudas(), p.getDeclaranteRenta()};
+    }
+    static double ingresos(const Almacen& a, size_t i) { return a[i].getIngresosAnuales(); }
+    static double patrimonio(const Almacen& a, size_t i) { return a[i].getPatrimonio(); }
+    static double deudas(const Almacen& a, size_t i) { return a[i].getDeudas(); }
+    static bool declarante(const Almacen& a, size_t i) { return a[i].getDeclaranteRenta(); }
+};
+
+#endif // DISPOSICION_CLASE_H
@@ -0,0 +1,35 @@
+#ifndef DISPOSICION_ESTRUCTURA_H
+#define DISPOSICION_ESTRUCTURA_H
+
+#include "fuente_datos.h"
+#include "../medida_estructura/persona.h"
+#include <string>
+#include <vector>
+
+// Struct Persona de medida_estructura en un vector (arreglo de structs):
+// un std::string por campo de texto
+struct DisposicionEstructura {
+    static constexpr const char* nombre = "estructura";
+    using Almacen = std::vector<Persona>;
+
+    static void reservar(Almacen& a, size_t n) { a.reserve(n); }
+    static void agregar(Almacen& a, const CamposPersona& c) {
+        a.push_back({std::string(c.nombre), std::string(c.apellido), std::string(c.id),
+                     std::string(c.ciudadNacimiento), std::string(c.fechaNacimiento),
+                     c.ingresosAnuales, c.patrimonio, c.deudas, c.declaranteRenta});
+    }
+    static size_t tam(const Almacen& a) { return a.size(); }
+
+    static std::string_view id(const Almacen& a, size_t i) { return a[i].id; }
+    static CamposPersona fila(const Almacen& a, size_t i) {
+        const Persona& p = a[i];
+        return {p.nombre, p.apellido, p.id, p.ciudadNacimiento, p.fechaNacimiento,
+                p.ingresosAnuales, p.patrimonio, p.deudas, p.declaranteRenta};
+    }
+    static double ingresos(const Almacen& a, size_t i) { return a[i].ingresosAnuales; }
+    static double patrimonio(const Almacen& a, size_t i) { return a[i].patrimonio; }
+    static double deudas(const Almacen& a, size_t i) { return a[i].deudas; }
+    static bool declarante(const Almacen& a, size_t i) { return a[i].declaranteRenta; }
+};
+
+#endif // DISPOSICION_ESTRUCTURA_H
@@ -0,0 +1,44 @@
+#ifndef DISPOSICION_FIJA_H
+#define DISPOSICION_FIJA_H
+
+#include "fuente_datos.h"
+#include "../medida_fija/persona_fija.h"
+#include <cstring>  // std::memset
+#include <vector>
+
+// PersonaFija de medida_fija: registro de 112 bytes con los textos en línea,
+// sin memoria dinámica por persona
+struct DisposicionFija {
+    static constexpr const char* nombre = "fija";
+    using Almacen = std::vector<PersonaFija>;
+
+    static void reservar(Almacen& a, size_t n) { a.reserve(n); }
+    static void agregar(Almacen& a, const CamposPersona& c) {
+        PersonaFija p;
+        std::memset(&p, 0, sizeof(p));
+        p.nombre.asignar(c.nombre);
+        p.apellido.asignar(c.apellido);
+        p.id.asignar(c.id);
+        p.ciudadNacimiento.asignar(c.ciudadNacimiento);
+        p.fechaNacimiento.asignar(c.fechaNacimiento);
+        p.ingresosAnuales = c.ingresosAnuales;
+        p.patrimonio = c.patrimonio;
+        p.deudas = c.deudas;
+        p.declaranteRenta = c.declaranteRenta;
+        a.push_back(p);
+    }
+    static size_t tam(const Almacen& a) { return a.size(); }
+
+    static std::string_view id(const Almacen& a, size_t i) { return a[i].id.vista(); }
+    static CamposPersona fila(const Almacen& a, size_t i) {
+        const PersonaFija& p = a[i];
+        return {p.nombre.vista(), p.apellido.vista(), p.id.vista(), p.ciudadNacimiento.vista(),
+                p.fechaNacimiento.vista(), p.ingresosAnuales, p.patrimonio, p.deudas, p.declaranteRenta};
+    }
+    static double ingresos(const Almacen& a, size_t i) { return a[i].ingresosAnuales; }
+    static double patrimonio(const Almacen& a, size_t i) { return a[i].patrimonio; }
+    static double deudas(const Almacen& a, size_t i) { return a[i].deudas; }
+    static bool declarante(const Almacen& a, size_t i) { return a[i].declaranteRenta; }
+};
+
+#endif // DISPOSICION_FIJA_H
@@ -0,0 +1,33 @@
+#ifndef DISPOSICION_TABLA_H
+#define DISPOSICION_TABLA_H
+
+#include "fuente_datos.h"
+#include "../medida_estructura/persona_tabla.h"
+#include <string>
+
+// PersonaTable de medida_estructura (columnar): un vector por atributo y
+// declaranteRenta empaquetado en un bitmap
+struct DisposicionTabla {
+    static constexpr const char* nombre = "tabla";
+    using Almacen = PersonaTable;
+
+    static void reservar(Almacen& a, size_t n) { a.reserve(n); }
+    static void agregar(Almacen& a, const CamposPersona& c) {
+        a.agregar({std::string(c.nombre), std::string(c.apellido), std::string(c.id),
+                   std::string(c.ciudadNacimiento), std::string(c.fechaNacimiento),
+                   c.ingresosAnuales, c.patrimonio, c.deudas, c.declaranteRenta});
+    }
+    static size_t tam(const Almacen& a) { return a.size(); }
+
+    static std::string_view id(const Almacen& a, size_t i) { return a.id[i]; }
+    static CamposPersona fila(const Almacen& a, size_t i) {
+        return {a.nombre[i], a.apellido[i], a.id[i], a.ciudadNacimiento[i], a.fechaNacimiento[i],
+                a.ingresosAnuales[i], a.patrimonio[i], a.deudas[i], a.esDeclarante(i)};
+    }
+    static double ingresos(const Almacen& a, size_t i) { return a.ingresosAnuales[i]; }
+    static double patrimonio(const Almacen& a, size_t i) { return a.patrimonio[i]; }
+    static double deudas(const Almacen& a, size_t i) { return a.deudas[i]; }
+    static bool declarante(const Almacen& a, size_t i) { return a.esDeclarante(i); }
+};
+
+#endif // DISPOSICION_TABLA_H
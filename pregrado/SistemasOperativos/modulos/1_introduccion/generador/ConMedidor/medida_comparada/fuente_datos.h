@@ -0,0 +1,87 @@
+#ifndef FUENTE_DATOS_H
+#define FUENTE_DATOS_H
+
+#include <charconv>     // std::to_chars
+#include <iterator>     // std::size
+#include <random>
+#include <string_view>
+
+// Campos de una persona: los textos apuntan al vocabulario, a la fuente o al almacén de origen
+struct CamposPersona {
+    std::string_view nombre;
+    std::string_view apellido;
+    std::string_view id;
+    std::string_view ciudadNacimiento;
+    std::string_view fechaNacimiento;
+    double ingresosAnuales;
+    double patrimonio;
+    double deudas;
+    bool declaranteRenta;
+};
+
+// Sorteo determinista de personas, común a todas las disposiciones.
+// Mismas distribuciones que los generadores de medida_clases y medida_fija, pero
+// sin tipos propios: cada disposición copia los campos a su representación, así
+// todas guardan exactamente los mismos datos para una semilla dada.
+class FuenteDatos {
+public:
+    static constexpr long ID_INICIAL = 1000000000;
+
+    explicit FuenteDatos(unsigned semilla) : motor(semilla) {}
+
+    // Los textos devueltos son válidos hasta la siguiente llamada
+    CamposPersona siguiente() {
+        static constexpr std::string_view femeninos[] = {
+            "María", "Luisa", "Carmen", "Ana", "Sofía", "Isabel", "Laura", "Andrea", "Paula", "Valentina",
+            "Camila", "Daniela", "Carolina", "Fernanda", "Gabriela", "Patricia", "Claudia", "Diana", "Lucía", "Ximena"};
+        static constexpr std::string_view masculinos[] = {
+            "Juan", "Carlos", "José", "James", "Andrés", "Miguel", "Luis", "Pedro", "Alejandro", "Ricardo",
+            "Felipe", "David", "Jorge", "Santiago", "Daniel", "Fernando", "Diego", "Rafael", "Martín", "Óscar",
+            "Edison", "Nestor", "Gertridis"};
+        static constexpr std::string_view apellidos[] = {
+            "Gómez", "Rodríguez", "Martínez", "López", "García", "Pérez", "González", "Sánchez", "Ramírez",
+            "Torres", "Díaz", "Vargas", "Castro", "Ruiz", "Álvarez", "Romero", "Suárez", "Rojas", "Moreno",
+            "Muñoz", "Valencia"};
+        static constexpr std::string_view ciudades[] = {
+            "Bogotá", "Medellín", "Cali", "Barranquilla", "Cartagena", "Bucaramanga", "Pereira", "Santa Marta",
+            "Cúcuta", "Ibagué", "Manizales", "Pasto", "Neiva", "Villavicencio", "Armenia", "Sincelejo",
+            "Valledupar", "Montería", "Popayán", "Tunja"};
+
+        CamposPersona r;
+        r.nombre = (motor() % 2) ? masculinos[motor() % std::size(masculinos)]
+                                 : femeninos[motor() % std::size(femeninos)];
+
+        std::string_view primero = apellidos[motor() % std::size(apellidos)];
+        std::string_view segundo = apellidos[motor() % std::size(apellidos)];
+        size_t largo = primero.copy(apellido, primero.size());
+        apellido[largo++] = ' ';
+        largo += segundo.copy(apellido + largo, segundo.size());
+        r.apellido = std::string_view(apellido, largo);
+
+        r.id = std::string_view(id, std::to_chars(id, id + sizeof(id), ID_INICIAL + contador++).ptr - id);
+        r.ciudadNacimiento = ciudades[motor() % std::size(ciudades)];
+
+        char* fin = std::to_chars(fecha, fecha + 2, 1 + motor() % 28).ptr;
+        *fin++ = '/';
+        fin = std::to_chars(fin, fin + 2, 1 + motor() % 12).ptr;
+        *fin++ = '/';
+        fin = std::to_chars(fin, fin + 4, 1960 + motor() % 50).ptr;
+        r.fechaNacimiento = std::string_view(fecha, fin - fecha);
+
+        // Ingresos entre 10M y 500M, patrimonio hasta 2.000M, deudas hasta el 70% del patrimonio
+        r.ingresosAnuales = std::uniform_real_distribution<double>(10000000, 500000000)(motor);
+        r.patrimonio = std::uniform_real_distribution<double>(0, 2000000000)(motor);
+        r.deudas = std::uniform_real_distribution<double>(0, r.patrimonio * 0.7)(motor);
+        r.declaranteRenta = (r.ingresosAnuales > 50000000) && (motor() % 100 > 30);
+        return r;
+    }
+
+private:
+    std::mt19937 motor;
+    long contador = 0;
+    char apellido[64];
+    char id[24];
+    char fecha[16];
+};
+
+#endif // FUENTE_DATOS_H
@@ -0,0 +1,213 @@
+#include "agregados.h"
+#include <algorithm> // std::min, std::max
+
+#if defined(__x86_64__)
+#define AGREGADOS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// --- Versión escalar (referencia y último recurso) ---
+
+template <typename Valor>
+ResumenColumna reducirEscalar(size_t n, Valor valor) {
+    ResumenColumna r;
+    r.n = n;
+    if (n == 0) {
+        return r;
+    }
+    r.minimo = r.maximo = valor(0);
+    for (size_t i = 0; i < n; ++i) {
+        double v = valor(i);
+        r.suma += v;
+        r.minimo = std::min(r.minimo, v);
+        r.maximo = std::max(r.maximo, v);
+    }
+    return r;
+}
+
+#ifdef AGREGADOS_X86
+
+// --- SSE2: 2 doubles por registro, dos acumuladores para ocultar la latencia de la suma ---
+// (SSE2 es parte de x86-64, así que no necesita atributo de objetivo)
+
+// Carga 2 valores de a (o de a - b)
+template <bool Diferencia>
+inline __m128d cargar128(const double* a, const double* b, size_t i) {
+    __m128d v = _mm_loadu_pd(a + i);
+    return Diferencia ? _mm_sub_pd(v, _mm_loadu_pd(b + i)) : v;
+}
+
+template <bool Diferencia>
+ResumenColumna reducirSSE2(const double* a, const double* b, size_t n) {
+    ResumenColumna r;
+    r.n = n;
+    if (n < 4) {
+        return reducirEscalar(n, [&](size_t i) { return Diferencia ? a[i] - b[i] : a[i]; });
+    }
+    __m128d suma0 = _mm_setzero_pd(), suma1 = _mm_setzero_pd();
+    __m128d min0 = cargar128<Diferencia>(a, b, 0), max0 = min0;
+    __m128d min1 = cargar128<Diferencia>(a, b, 2), max1 = min1;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128d v0 = cargar128<Diferencia>(a, b, i);
+        __m128d v1 = cargar128<Diferencia>(a, b, i + 2);
+        suma0 = _mm_add_pd(suma0, v0);
+        suma1 = _mm_add_pd(suma1, v1);
+        min0 = _mm_min_pd(min0, v0);
+        min1 = _mm_min_pd(min1, v1);
+        max0 = _mm_max_pd(max0, v0);
+        max1 = _mm_max_pd(max1, v1);
+    }
+
+    alignas(16) double s[2], mn[2], mx[2];
+    _mm_store_pd(s, _mm_add_pd(suma0, suma1));
+    _mm_store_pd(mn, _mm_min_pd(min0, min1));
+    _mm_store_pd(mx, _mm_max_pd(max0, max1));
+    r.suma = s[0] + s[1];
+    r.minimo = std::min(mn[0], mn[1]);
+    r.maximo = std::max(mx[0], mx[1]);
+
+    for (; i < n; ++i) { // Cola que no llena un bloque
+        double v = Diferencia ? a[i] - b[i] : a[i];
+        r.suma += v;
+        r.minimo = std::min(r.minimo, v);
+        r.maximo = std::max(r.maximo, v);
+    }
+    return r;
+}
+
+// --- AVX2: 4 doubles por registro, dos acumuladores (8 doubles por iteración) ---
+
+// Carga 4 valores de a (o de a - b)
+template <bool Diferencia>
+__attribute__((target("avx2")))
+inline __m256d cargar256(const double* a, const double* b, size_t i) {
+    __m256d v = _mm256_loadu_pd(a + i);
+    return Diferencia ? _mm256_sub_pd(v, _mm256_loadu_pd(b + i)) : v;
+}
+
+template <bool Diferencia>
+__attribute__((target("avx2")))
+ResumenColumna reducirAVX2(const double* a, const double* b, size_t n) {
+    ResumenColumna r;
+    r.n = n;
+    if (n < 8) {
+        return reducirEscalar(n, [&](size_t i) { return Diferencia ? a[i] - b[i] : a[i]; });
+    }
+    __m256d suma0 = _mm256_setzero_pd(), suma1 = _mm256_setzero_pd();
+    __m256d min0 = cargar256<Diferencia>(a, b, 0), max0 = min0;
+    __m256d min1 = cargar256<Diferencia>(a, b, 4), max1 = min1;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256d v0 = cargar256<Diferencia>(a, b, i);
+        __m256d v1 = cargar256<Diferencia>(a, b, i + 4);
+        suma0 = _mm256_add_pd(suma0, v0);
+        suma1 = _mm256_add_pd(suma1, v1);
+        min0 = _mm256_min_pd(min0, v0);
+        min1 = _mm256_min_pd(min1, v1);
+        max0 = _mm256_max_pd(max0, v0);
+        max1 = _mm256_max_pd(max1, v1);
+    }
+
+    alignas(32) double s[4], mn[4], mx[4];
+    _mm256_store_pd(s, _mm256_add_pd(suma0, suma1));
+    _mm256_store_pd(mn, _mm256_min_pd(min0, min1));
+    _mm256_store_pd(mx, _mm256_max_pd(max0, max1));
+    r.suma = (s[0] + s[1]) + (s[2] + s[3]);
+    r.minimo = std::min(std::min(mn[0], mn[1]), std::min(mn[2], mn[3]));
+    r.maximo = std::max(std::max(mx[0], mx[1]), std::max(mx[2], mx[3]));
+
+    for (; i < n; ++i) { // Cola que no llena un bloque
+        double v = Diferencia ? a[i] - b[i] : a[i];
+        r.suma += v;
+        r.minimo = std::min(r.minimo, v);
+        r.maximo = std::max(r.maximo, v);
+    }
+    return r;
+}
+
+__attribute__((target("popcnt")))
+size_t contarBitsPopcnt(const uint64_t* palabras, size_t numPalabras) {
+    // Cuatro contadores independientes: la CPU ejecuta varios POPCNT por ciclo
+    size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    size_t i = 0;
+    for (; i + 4 <= numPalabras; i += 4) {
+        c0 += _mm_popcnt_u64(palabras[i]);
+        c1 += _mm_popcnt_u64(palabras[i + 1]);
+        c2 += _mm_popcnt_u64(palabras[i + 2]);
+        c3 += _mm_popcnt_u64(palabras[i + 3]);
+    }
+    for (; i < numPalabras; ++i) {
+        c0 += _mm_popcnt_u64(palabras[i]);
+    }
+    return c0 + c1 + c2 + c3;
+}
+
+#endif // AGREGADOS_X86
+
+// Reducción con el nivel pedido (baja al escalar si no hay soporte x86)
+template <bool Diferencia>
+ResumenColumna reducir(const double* a, const double* b, size_t n, NivelSimd nivel) {
+#ifdef AGREGADOS_X86
+    switch (nivel) {
+        case NivelSimd::AVX2: return reducirAVX2<Diferencia>(a, b, n);
+        case NivelSimd::SSE2: return reducirSSE2<Diferencia>(a, b, n);
+        case NivelSimd::Escalar: break;
+    }
+#else
+    (void)nivel;
+#endif
+    return reducirEscalar(n, [&](size_t i) { return Diferencia ? a[i] - b[i] : a[i]; });
+}
+
+} // namespace
+
+NivelSimd nivelSimdDisponible() {
+#ifdef AGREGADOS_X86
+    static const NivelSimd nivel = __builtin_cpu_supports("avx2") ? NivelSimd::AVX2 : NivelSimd::SSE2;
+    return nivel;
+#else
+    return NivelSimd::Escalar;
+#endif
+}
+
+const char* nombreNivel(NivelSimd nivel) {
+    switch (nivel) {
+        case NivelSimd::AVX2: return "AVX2";
+        case NivelSimd::SSE2: return "SSE2";
+        case NivelSimd::Escalar: break;
+    }
+    return "escalar";
+}
+
+ResumenColumna resumirColumna(const double* datos, size_t n) {
+    return resumirColumna(datos, n, nivelSimdDisponible());
+}
+
+ResumenColumna resumirColumna(const double* datos, size_t n, NivelSimd nivel) {
+    return reducir<false>(datos, nullptr, n, nivel);
+}
+
+ResumenColumna resumirDiferencia(const double* a, const double* b, size_t n) {
+    return resumirDiferencia(a, b, n, nivelSimdDisponible());
+}
+
+ResumenColumna resumirDiferencia(const double* a, const double* b, size_t n, NivelSimd nivel) {
+    return reducir<true>(a, b, n, nivel);
+}
+
+size_t contarBits(const uint64_t* palabras, size_t numPalabras) {
+#ifdef AGREGADOS_X86
+    static const bool hayPopcnt = __builtin_cpu_supports("popcnt");
+    if (hayPopcnt) {
+        return contarBitsPopcnt(palabras, numPalabras);
+    }
+#endif
+    size_t total = 0;
+    for (size_t i = 0; i < numPalabras; ++i) {
+        total += __builtin_popcountll(palabras[i]);
+    }
+    return total;
+}
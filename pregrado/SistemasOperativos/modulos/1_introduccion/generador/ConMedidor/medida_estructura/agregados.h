@@ -0,0 +1,45 @@
+#ifndef AGREGADOS_H
+#define AGREGADOS_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Núcleos de reducción sobre columnas contiguas de double (total, media, mínimo, máximo)
+// y conteo de bits del bitmap de declarantes.
+// Cada núcleo tiene versión AVX2, SSE2 y escalar; la mejor disponible en la CPU
+// se elige en tiempo de ejecución, así el mismo binario corre en cualquier x86-64.
+
+// Juego de instrucciones usado por los núcleos
+enum class NivelSimd { Escalar, SSE2, AVX2 };
+
+// Resultado de reducir una columna
+struct ResumenColumna {
+    double suma = 0;
+    double minimo = 0;
+    double maximo = 0;
+    size_t n = 0;
+
+    double media() const { return n ? suma / n : 0; }
+};
+
+// Mejor nivel soportado por la CPU actual (se detecta una sola vez)
+NivelSimd nivelSimdDisponible();
+
+// Nombre legible del nivel ("AVX2", "SSE2", "escalar")
+const char* nombreNivel(NivelSimd nivel);
+
+// Suma, mínimo y máximo de datos[0..n).
+// Los niveles vectoriales suman en varios acumuladores, así que el total puede
+// diferir del escalar en el último bit (otro orden de redondeo).
+ResumenColumna resumirColumna(const double* datos, size_t n);
+ResumenColumna resumirColumna(const double* datos, size_t n, NivelSimd nivel);
+
+// Igual que resumirColumna sobre a[i] - b[i] (p. ej. patrimonio neto = patrimonio - deudas),
+// calculado al vuelo sin materializar la columna de diferencias
+ResumenColumna resumirDiferencia(const double* a, const double* b, size_t n);
+ResumenColumna resumirDiferencia(const double* a, const double* b, size_t n, NivelSimd nivel);
+
+// Número de bits en 1 de un bitmap empaquetado (instrucción POPCNT si existe)
+size_t contarBits(const uint64_t* palabras, size_t numPalabras);
+
+#endif // AGREGADOS_H
@@ -0,0 +1,356 @@
+#include "almacen_comprimido.h"
+#include <algorithm> // std::min, std::max
+
+namespace {
+
+// Bits necesarios para representar 'valor' (0 para el valor 0)
+unsigned bitsNecesarios(uint64_t valor) {
+    return valor == 0 ? 0 : 64 - __builtin_clzll(valor);
+}
+
+// Escribe los 'ancho' bits bajos de 'valor' a partir del bit 'pos'
+inline void escribirBits(uint64_t* palabras, size_t pos, uint64_t valor, unsigned ancho) {
+    if (ancho == 0) {
+        return;
+    }
+    size_t w = pos >> 6;
+    unsigned d = pos & 63;
+    palabras[w] |= valor << d;
+    if (d + ancho > 64) {
+        palabras[w + 1] |= valor >> (64 - d);
+    }
+}
+
+// Lee 'filas' valores consecutivos de 'ancho' bits desde el bit 'pos' y
+// entrega cada uno a guardar(j, valor)
+template <typename Guardar>
+inline void desempaquetar(const uint64_t* palabras, size_t pos, unsigned ancho, size_t filas,
+                          Guardar guardar) {
+    if (ancho == 0) {
+        for (size_t j = 0; j < filas; ++j) {
+            guardar(j, 0);
+        }
+        return;
+    }
+    const uint64_t mascara = (ancho == 64) ? ~0ULL : (1ULL << ancho) - 1;
+    for (size_t j = 0; j < filas; ++j, pos += ancho) {
+        size_t w = pos >> 6;
+        unsigned d = pos & 63;
+        uint64_t v = palabras[w] >> d;
+        if (d + ancho > 64) {
+            v |= palabras[w + 1] << (64 - d);
+        }
+        guardar(j, v & mascara);
+    }
+}
+
+// Lee un entero decimal de 1 a 'maxDigitos' dígitos, sin ceros a la izquierda (así
+// el texto se reconstruye idéntico), que termina en 'fin' o en 'separador'
+bool leerNumero(const char*& p, const char* fin, char separador, size_t maxDigitos, uint64_t& valor) {
+    const char* inicio = p;
+    valor = 0;
+    while (p < fin && *p != separador) {
+        if (*p < '0' || *p > '9' || static_cast<size_t>(p - inicio) == maxDigitos
+            || (p > inicio && *inicio == '0')) {
+            return false;
+        }
+        valor = valor * 10 + static_cast<uint64_t>(*p - '0');
+        ++p;
+    }
+    return p > inicio;
+}
+
+bool leerId(const std::string& texto, uint64_t& valor) {
+    const char* p = texto.data();
+    const char* fin = texto.data() + texto.size();
+    return leerNumero(p, fin, '\0', 19, valor) && p == fin;
+}
+
+// Fecha "D/M/AAAA" (día y mes con 1 o 2 dígitos)
+bool leerFecha(const std::string& texto, uint8_t& dia, uint8_t& mes, uint16_t& anio) {
+    const char* p = texto.data();
+    const char* fin = texto.data() + texto.size();
+    uint64_t d, m, a;
+    if (!leerNumero(p, fin, '/', 2, d) || p == fin || !leerNumero(++p, fin, '/', 2, m) || p == fin
+        || !leerNumero(++p, fin, '/', 4, a) || p != fin) {
+        return false;
+    }
+    if (d < 1 || d > 31 || m < 1 || m > 12 || a < 1) {
+        return false;
+    }
+    dia = static_cast<uint8_t>(d);
+    mes = static_cast<uint8_t>(m);
+    anio = static_cast<uint16_t>(a);
+    return true;
+}
+
+// Escribe 'valor' en decimal al final de 'destino'; devuelve el nuevo final
+char* escribirDecimal(char* destino, uint64_t valor) {
+    char digitos[20];
+    int k = 0;
+    do {
+        digitos[k++] = static_cast<char>('0' + valor % 10);
+        valor /= 10;
+    } while (valor > 0);
+    while (k > 0) {
+        *destino++ = digitos[--k];
+    }
+    return destino;
+}
+
+template <typename T>
+size_t bytesVector(const std::vector<T>& v) {
+    return v.capacity() * sizeof(T);
+}
+
+} // namespace
+
+// --- DiccionarioTextos ---
+
+uint32_t DiccionarioTextos::codificar(const std::string& texto) {
+    auto it = codigos.find(texto);
+    if (it != codigos.end()) {
+        return it->second;
+    }
+    uint32_t codigo = static_cast<uint32_t>(textos.size());
+    textos.push_back(texto);
+    codigos.emplace(texto, codigo);
+    return codigo;
+}
+
+bool DiccionarioTextos::buscar(const std::string& texto, uint32_t& codigo) const {
+    auto it = codigos.find(texto);
+    if (it == codigos.end()) {
+        return false;
+    }
+    codigo = it->second;
+    return true;
+}
+
+size_t DiccionarioTextos::memoria_bytes() const {
+    // Cada texto está dos veces (vector y clave del mapa); el mapa suma un nodo por
+    // entrada y un puntero por cubeta
+    size_t total = bytesVector(textos) + codigos.bucket_count() * sizeof(void*);
+    const std::string vacio;
+    for (const auto& t : textos) {
+        size_t heap = t.capacity() > vacio.capacity() ? t.capacity() + 1 : 0;
+        total += 2 * heap + sizeof(std::pair<const std::string, uint32_t>) + sizeof(void*);
+    }
+    return total;
+}
+
+// --- AlmacenComprimido ---
+
+void AlmacenComprimido::BloqueAbierto::limpiar() {
+    nombre.clear();
+    apellido.clear();
+    ciudad.clear();
+    id.clear();
+    anio.clear();
+    mes.clear();
+    dia.clear();
+}
+
+void AlmacenComprimido::reservar(size_t filas) {
+    ingresos.reserve(filas);
+    patrimonio.reserve(filas);
+    deudas.reserve(filas);
+    declarantes.reserve((filas + 63) / 64);
+    bloques.reserve((filas + BLOQUE - 1) / BLOQUE);
+}
+
+bool AlmacenComprimido::agregar(const Persona& p) {
+    uint64_t id;
+    uint8_t dia, mes;
+    uint16_t anio;
+    if (!leerId(p.id, id) || !leerFecha(p.fechaNacimiento, dia, mes, anio)) {
+        return false;
+    }
+    abierto.nombre.push_back(dicNombres.codificar(p.nombre));
+    abierto.apellido.push_back(dicApellidos.codificar(p.apellido));
+    abierto.ciudad.push_back(dicCiudades.codificar(p.ciudadNacimiento));
+    abierto.id.push_back(id);
+    abierto.anio.push_back(anio);
+    abierto.mes.push_back(mes);
+    abierto.dia.push_back(dia);
+
+    ingresos.push_back(p.ingresosAnuales);
+    patrimonio.push_back(p.patrimonio);
+    deudas.push_back(p.deudas);
+    if ((n & 63) == 0) {
+        declarantes.push_back(0);
+    }
+    declarantes.back() |= static_cast<uint64_t>(p.declaranteRenta) << (n & 63);
+    ++n;
+
+    if (abierto.size() == BLOQUE) {
+        sellar();
+    }
+    return true;
+}
+
+void AlmacenComprimido::sellar() {
+    const size_t filas = abierto.size();
+    Bloque b;
+
+    uint32_t maxNombre = 0, maxApellido = 0, maxCiudad = 0;
+    uint16_t minAnio = UINT16_MAX, maxAnio = 0;
+    // id - j: constante para IDs consecutivos (el ancho queda en 0). Todo en
+    // uint64_t: leerId acepta hasta 19 dígitos (más que INT64_MAX) y la resta
+    // módulo 2^64 se deshace igual al decodificar (base + j + v)
+    uint64_t minId = UINT64_MAX, maxId = 0;
+    for (size_t j = 0; j < filas; ++j) {
+        maxNombre = std::max(maxNombre, abierto.nombre[j]);
+        maxApellido = std::max(maxApellido, abierto.apellido[j]);
+        maxCiudad = std::max(maxCiudad, abierto.ciudad[j]);
+        minAnio = std::min(minAnio, abierto.anio[j]);
+        maxAnio = std::max(maxAnio, abierto.anio[j]);
+        uint64_t v = abierto.id[j] - j;
+        minId = std::min(minId, v);
+        maxId = std::max(maxId, v);
+    }
+    b.anchoNombre = static_cast<uint8_t>(bitsNecesarios(maxNombre));
+    b.anchoApellido = static_cast<uint8_t>(bitsNecesarios(maxApellido));
+    b.anchoCiudad = static_cast<uint8_t>(bitsNecesarios(maxCiudad));
+    b.anchoId = static_cast<uint8_t>(bitsNecesarios(maxId - minId));
+    b.anchoAnio = static_cast<uint8_t>(bitsNecesarios(maxAnio - minAnio));
+    b.baseId = minId;
+    b.baseAnio = minAnio;
+
+    const unsigned anchoFecha = 9 + b.anchoAnio;
+    const size_t totalBits = filas * (b.anchoNombre + b.anchoApellido + b.anchoCiudad + b.anchoId + anchoFecha);
+    b.bits.assign((totalBits + 63) / 64 + 1, 0); // +1: la lectura de un valor puede tocar la palabra siguiente
+
+    uint64_t* bits = b.bits.data();
+    size_t pos = 0;
+    for (size_t j = 0; j < filas; ++j, pos += b.anchoNombre) {
+        escribirBits(bits, pos, abierto.nombre[j], b.anchoNombre);
+    }
+    for (size_t j = 0; j < filas; ++j, pos += b.anchoApellido) {
+        escribirBits(bits, pos, abierto.apellido[j], b.anchoApellido);
+    }
+    for (size_t j = 0; j < filas; ++j, pos += b.anchoCiudad) {
+        escribirBits(bits, pos, abierto.ciudad[j], b.anchoCiudad);
+    }
+    for (size_t j = 0; j < filas; ++j, pos += b.anchoId) {
+        escribirBits(bits, pos, abierto.id[j] - j - b.baseId, b.anchoId);
+    }
+    for (size_t j = 0; j < filas; ++j, pos += anchoFecha) {
+        uint64_t fecha = abierto.dia[j] | (abierto.mes[j] << 5)
+                       | (static_cast<uint64_t>(abierto.anio[j] - b.baseAnio) << 9);
+        escribirBits(bits, pos, fecha, anchoFecha);
+    }
+
+    bloques.push_back(std::move(b));
+    abierto.limpiar();
+}
+
+void AlmacenComprimido::decodificar(size_t k, unsigned campos, BloqueDecodificado& salida) const {
+    if (salida.id.size() < BLOQUE) {
+        salida.nombre.resize(BLOQUE);
+        salida.apellido.resize(BLOQUE);
+        salida.ciudad.resize(BLOQUE);
+        salida.id.resize(BLOQUE);
+        salida.anio.resize(BLOQUE);
+        salida.mes.resize(BLOQUE);
+        salida.dia.resize(BLOQUE);
+    }
+    salida.inicio = k * BLOQUE;
+    salida.ingresos = ingresos.data() + salida.inicio;
+    salida.patrimonio = patrimonio.data() + salida.inicio;
+    salida.deudas = deudas.data() + salida.inicio;
+    salida.declarantes = declarantes.data();
+
+    if (k == bloques.size()) {
+        // Bloque abierto: los valores ya están sin comprimir
+        const size_t filas = abierto.size();
+        salida.filas = filas;
+        std::copy(abierto.nombre.begin(), abierto.nombre.end(), salida.nombre.begin());
+        std::copy(abierto.apellido.begin(), abierto.apellido.end(), salida.apellido.begin());
+        std::copy(abierto.ciudad.begin(), abierto.ciudad.end(), salida.ciudad.begin());
+        std::copy(abierto.id.begin(), abierto.id.end(), salida.id.begin());
+        std::copy(abierto.anio.begin(), abierto.anio.end(), salida.anio.begin());
+        std::copy(abierto.mes.begin(), abierto.mes.end(), salida.mes.begin());
+        std::copy(abierto.dia.begin(), abierto.dia.end(), salida.dia.begin());
+        return;
+    }
+
+    const Bloque& b = bloques[k];
+    const uint64_t* bits = b.bits.data();
+    const size_t filas = BLOQUE;
+    salida.filas = filas;
+    size_t pos = 0;
+
+    if (campos & NOMBRE) {
+        uint32_t* destino = salida.nombre.data();
+        desempaquetar(bits, pos, b.anchoNombre, filas, [=](size_t j, uint64_t v) { destino[j] = static_cast<uint32_t>(v); });
+    }
+    pos += filas * b.anchoNombre;
+    if (campos & APELLIDO) {
+        uint32_t* destino = salida.apellido.data();
+        desempaquetar(bits, pos, b.anchoApellido, filas, [=](size_t j, uint64_t v) { destino[j] = static_cast<uint32_t>(v); });
+    }
+    pos += filas * b.anchoApellido;
+    if (campos & CIUDAD) {
+        uint32_t* destino = salida.ciudad.data();
+        desempaquetar(bits, pos, b.anchoCiudad, filas, [=](size_t j, uint64_t v) { destino[j] = static_cast<uint32_t>(v); });
+    }
+    pos += filas * b.anchoCiudad;
+    if (campos & ID) {
+        uint64_t* destino = salida.id.data();
+        const uint64_t base = b.baseId;
+        desempaquetar(bits, pos, b.anchoId, filas, [=](size_t j, uint64_t v) { destino[j] = base + j + v; });
+    }
+    pos += filas * b.anchoId;
+    if (campos & FECHA) {
+        uint16_t* anio = salida.anio.data();
+        uint8_t* mes = salida.mes.data();
+        uint8_t* dia = salida.dia.data();
+        const uint16_t base = b.baseAnio;
+        desempaquetar(bits, pos, 9 + b.anchoAnio, filas, [=](size_t j, uint64_t v) {
+            dia[j] = static_cast<uint8_t>(v & 31);
+            mes[j] = static_cast<uint8_t>((v >> 5) & 15);
+            anio[j] = static_cast<uint16_t>(base + (v >> 9));
+        });
+    }
+}
+
+void AlmacenComprimido::persona(const BloqueDecodificado& b, size_t j, Persona& p) const {
+    p.nombre = dicNombres.texto(b.nombre[j]);
+    p.apellido = dicApellidos.texto(b.apellido[j]);
+    p.ciudadNacimiento = dicCiudades.texto(b.ciudad[j]);
+
+    char texto[24];
+    p.id.assign(texto, escribirDecimal(texto, b.id[j]));
+    char* fin = escribirDecimal(texto, b.dia[j]);
+    *fin++ = '/';
+    fin = escribirDecimal(fin, b.mes[j]);
+    *fin++ = '/';
+    fin = escribirDecimal(fin, b.anio[j]);
+    p.fechaNacimiento.assign(texto, fin);
+
+    p.ingresosAnuales = b.ingresos[j];
+    p.patrimonio = b.patrimonio[j];
+    p.deudas = b.deudas[j];
+    p.declaranteRenta = b.declarante(j);
+}
+
+Persona AlmacenComprimido::obtener(size_t fila) const {
+    BloqueDecodificado b;
+    decodificar(fila / BLOQUE, TODOS, b);
+    Persona p;
+    persona(b, fila % BLOQUE, p);
+    return p;
+}
+
+size_t AlmacenComprimido::memoria_bytes() const {
+    size_t total = bloques.capacity() * sizeof(Bloque);
+    for (const auto& b : bloques) {
+        total += bytesVector(b.bits);
+    }
+    total += bytesVector(ingresos) + bytesVector(patrimonio) + bytesVector(deudas) + bytesVector(declarantes);
+    total += bytesVector(abierto.nombre) + bytesVector(abierto.apellido) + bytesVector(abierto.ciudad)
+           + bytesVector(abierto.id) + bytesVector(abierto.anio) + bytesVector(abierto.mes)
+           + bytesVector(abierto.dia);
+    return total + dicNombres.memoria_bytes() + dicApellidos.memoria_bytes() + dicCiudades.memoria_bytes();
+}
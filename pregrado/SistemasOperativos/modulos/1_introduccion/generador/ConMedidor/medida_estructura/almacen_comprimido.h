@@ -0,0 +1,139 @@
+#ifndef ALMACEN_COMPRIMIDO_H
+#define ALMACEN_COMPRIMIDO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "persona.h"
+
+// Diccionario de textos: cada texto distinto recibe un código denso (orden de llegada)
+class DiccionarioTextos {
+public:
+    uint32_t codificar(const std::string& texto); // Agrega el texto si es nuevo
+    bool buscar(const std::string& texto, uint32_t& codigo) const;
+    const std::string& texto(uint32_t codigo) const { return textos[codigo]; }
+    size_t size() const { return textos.size(); }
+    size_t memoria_bytes() const;
+
+private:
+    std::vector<std::string> textos;
+    std::unordered_map<std::string, uint32_t> codigos;
+};
+
+// Almacén de personas comprimido por bloques de BLOQUE filas, para colecciones
+// de cientos de millones de registros.
+//
+// Cada bloque guarda sus campos de texto como enteros empaquetados en bits, con
+// el ancho mínimo que necesita ese bloque:
+//  - nombre, apellido, ciudad: código del diccionario del campo
+//  - id: los de generarID son consecutivos, así que se guarda id - posición en el
+//    bloque, relativo al menor de esos valores (marco de referencia). Con IDs
+//    consecutivos el ancho es 0 bits; con huecos crece solo lo necesario.
+//  - fecha: día (5 bits), mes (4 bits) y año relativo al menor año del bloque
+// Los double van sin comprimir en tres columnas contiguas y el declarante en un
+// mapa de bits. Las filas recién agregadas esperan en un bloque abierto sin
+// comprimir hasta completar BLOQUE.
+//
+// Los recorridos descomprimen un bloque a la vez en un BloqueDecodificado que se
+// reutiliza (24 KB de códigos: cabe en L1/L2) y solo los campos pedidos.
+class AlmacenComprimido {
+public:
+    static const size_t BLOQUE = 1024;
+
+    // Campos de texto a descomprimir en un recorrido (combinables con |)
+    enum Campo : unsigned {
+        NOMBRE = 1, APELLIDO = 2, CIUDAD = 4, ID = 8, FECHA = 16,
+        TODOS = NOMBRE | APELLIDO | CIUDAD | ID | FECHA
+    };
+
+    // Un bloque descomprimido: códigos y valores de las filas [inicio, inicio + filas)
+    struct BloqueDecodificado {
+        size_t inicio = 0;
+        size_t filas = 0;
+        std::vector<uint32_t> nombre, apellido, ciudad; // Códigos de diccionario
+        std::vector<uint64_t> id;
+        std::vector<uint16_t> anio;
+        std::vector<uint8_t> mes, dia;
+        const double* ingresos = nullptr;   // Apuntan a las columnas del almacén
+        const double* patrimonio = nullptr; // (ya desplazadas a 'inicio')
+        const double* deudas = nullptr;
+        const uint64_t* declarantes = nullptr; // Mapa de bits completo (bit = fila global)
+
+        bool declarante(size_t j) const {
+            size_t fila = inicio + j;
+            return (declarantes[fila >> 6] >> (fila & 63)) & 1;
+        }
+    };
+
+    // Agrega una persona. Devuelve false (sin agregarla) si el id no es un número
+    // decimal sin ceros a la izquierda o la fecha no tiene el formato D/M/AAAA.
+    bool agregar(const Persona& p);
+    void reservar(size_t filas); // Evita copiar las columnas al crecer (pico de 2x)
+
+    size_t size() const { return n; }
+    bool empty() const { return n == 0; }
+    size_t numBloques() const { return bloques.size(); }
+    size_t memoria_bytes() const; // Bloques, columnas, diccionarios y bloque abierto
+
+    const DiccionarioTextos& nombres() const { return dicNombres; }
+    const DiccionarioTextos& apellidos() const { return dicApellidos; }
+    const DiccionarioTextos& ciudades() const { return dicCiudades; }
+
+    // Recorre todas las filas bloque por bloque: descomprime los 'campos' pedidos
+    // y llama visitar(const BloqueDecodificado&)
+    template <typename Visitar>
+    void recorrer(unsigned campos, Visitar visitar) const;
+
+    // Reconstruye la fila j de un bloque decodificado con TODOS los campos
+    // (reutiliza los strings de 'p' para no asignar memoria en cada fila)
+    void persona(const BloqueDecodificado& b, size_t j, Persona& p) const;
+    Persona obtener(size_t fila) const; // Acceso directo: descomprime solo su bloque
+
+private:
+    // Bloque comprimido: anchos y bases del bloque y los bits de sus campos,
+    // columna tras columna (nombre, apellido, ciudad, id, fecha)
+    struct Bloque {
+        uint8_t anchoNombre = 0, anchoApellido = 0, anchoCiudad = 0, anchoId = 0, anchoAnio = 0;
+        uint16_t baseAnio = 0;
+        uint64_t baseId = 0;
+        std::vector<uint64_t> bits;
+    };
+
+    // Filas todavía sin comprimir (menos de BLOQUE)
+    struct BloqueAbierto {
+        std::vector<uint32_t> nombre, apellido, ciudad;
+        std::vector<uint64_t> id;
+        std::vector<uint16_t> anio;
+        std::vector<uint8_t> mes, dia;
+
+        size_t size() const { return id.size(); }
+        void limpiar();
+    };
+
+    void sellar(); // Comprime el bloque abierto y lo agrega a 'bloques'
+    void decodificar(size_t bloque, unsigned campos, BloqueDecodificado& salida) const;
+
+    std::vector<Bloque> bloques;
+    BloqueAbierto abierto;
+    DiccionarioTextos dicNombres, dicApellidos, dicCiudades;
+    std::vector<double> ingresos, patrimonio, deudas;
+    std::vector<uint64_t> declarantes;
+    size_t n = 0;
+};
+
+// --- Implementación inline ---
+
+template <typename Visitar>
+void AlmacenComprimido::recorrer(unsigned campos, Visitar visitar) const {
+    BloqueDecodificado b;
+    for (size_t k = 0; k <= bloques.size(); ++k) {
+        decodificar(k, campos, b); // k == bloques.size(): el bloque abierto
+        if (b.filas > 0) {
+            visitar(static_cast<const BloqueDecodificado&>(b));
+        }
+    }
+}
+
+#endif // ALMACEN_COMPRIMIDO_H
@@ -0,0 +1,423 @@
+#include "filtro.h"
+#include "agregados.h"  // contarBits
+#include "generador.h"  // ciudadesColombia
+#include <algorithm>    // std::stable_sort, std::min
+#include <cctype>
+#include <cstdlib>      // std::strtod
+#include <functional>   // std::less, std::greater, ...
+#include <sstream>
+
+namespace {
+
+// --- Análisis léxico ---
+
+struct Token {
+    enum Clase { Palabra, Numero, Texto, Operador, Fin } clase;
+    std::string texto;
+    double numero;
+};
+
+bool esLetra(unsigned char c) {
+    return std::isalpha(c) || c == '_' || c >= 0x80; // Bytes >= 0x80: letras acentuadas en UTF-8
+}
+
+// Parte la expresión en tokens; devuelve false con 'error' ante un carácter inesperado
+bool tokenizar(const std::string& s, std::vector<Token>& tokens, std::string& error) {
+    size_t i = 0;
+    while (i < s.size()) {
+        unsigned char c = s[i];
+        if (std::isspace(c)) {
+            ++i;
+        } else if (std::isdigit(c) || ((c == '.' || c == '-') && i + 1 < s.size()
+                                       && (std::isdigit(static_cast<unsigned char>(s[i + 1])) || s[i + 1] == '.'))) {
+            char* fin;
+            double v = std::strtod(s.c_str() + i, &fin);
+            size_t largo = fin - (s.c_str() + i);
+            if (largo == 0) {
+                error = "número inválido en la posición " + std::to_string(i);
+                return false;
+            }
+            tokens.push_back({Token::Numero, s.substr(i, largo), v});
+            i += largo;
+        } else if (c == '"' || c == '\'') {
+            size_t cierre = s.find(static_cast<char>(c), i + 1);
+            if (cierre == std::string::npos) {
+                error = "falta cerrar las comillas abiertas en la posición " + std::to_string(i);
+                return false;
+            }
+            tokens.push_back({Token::Texto, s.substr(i + 1, cierre - i - 1), 0});
+            i = cierre + 1;
+        } else if (esLetra(c)) {
+            size_t j = i;
+            while (j < s.size() && (esLetra(s[j]) || std::isdigit(static_cast<unsigned char>(s[j])))) {
+                ++j;
+            }
+            tokens.push_back({Token::Palabra, s.substr(i, j - i), 0});
+            i = j;
+        } else {
+            static const char* const operadores[] = {"==", "!=", "<>", "<=", ">=", "&&", "<", ">", "=", "*"};
+            bool encontrado = false;
+            for (const char* op : operadores) {
+                std::string o(op);
+                if (s.compare(i, o.size(), o) == 0) {
+                    tokens.push_back({Token::Operador, o, 0});
+                    i += o.size();
+                    encontrado = true;
+                    break;
+                }
+            }
+            if (!encontrado) {
+                error = std::string("carácter inesperado '") + s[i] + "' en la posición " + std::to_string(i);
+                return false;
+            }
+        }
+    }
+    tokens.push_back({Token::Fin, "", 0});
+    return true;
+}
+
+std::string minusculas(std::string s) {
+    for (char& c : s) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return s;
+}
+
+// Columna numérica por nombre (-1 si no es una)
+int columnaNumerica(const std::string& palabra) {
+    std::string p = minusculas(palabra);
+    if (p == "ingresos" || p == "ingresosanuales") return 0;
+    if (p == "patrimonio") return 1;
+    if (p == "deudas") return 2;
+    return -1;
+}
+
+const char* const NOMBRES_COLUMNA[] = {"ingresos", "patrimonio", "deudas"};
+
+const double* datosColumna(const PersonaTable& t, int columna) {
+    switch (columna) {
+        case 0: return t.ingresosAnuales.data();
+        case 1: return t.patrimonio.data();
+        default: return t.deudas.data();
+    }
+}
+
+// --- Núcleos por lote ---
+
+// Deja en sel[0..m) las filas que cumplen: con 'primero' las toma de [inicio, fin),
+// si no compacta sel[0..k) en sitio. Sin saltos dependientes de los datos.
+template <typename Cumple>
+size_t compactar(Cumple cumple, uint32_t* sel, size_t k, uint32_t inicio, uint32_t fin, bool primero) {
+    size_t m = 0;
+    if (primero) {
+        for (uint32_t i = inicio; i < fin; ++i) {
+            sel[m] = i;
+            m += cumple(i);
+        }
+    } else {
+        for (size_t j = 0; j < k; ++j) {
+            uint32_t i = sel[j];
+            sel[m] = i;
+            m += cumple(i);
+        }
+    }
+    return m;
+}
+
+// Comparación instanciada por operador: el bucle no decide el operador en cada fila
+template <typename Cmp>
+size_t comparar(Cmp cmp, const double* a, const double* b, double valor,
+                uint32_t* sel, size_t k, uint32_t inicio, uint32_t fin, bool primero) {
+    if (b) {
+        return compactar([=](uint32_t i) { return cmp(a[i], b[i] * valor); }, sel, k, inicio, fin, primero);
+    }
+    return compactar([=](uint32_t i) { return cmp(a[i], valor); }, sel, k, inicio, fin, primero);
+}
+
+} // namespace
+
+// Analizador descendente recursivo: una comparación por vez, unidas con AND
+bool Filtro::compilar(const std::string& texto, const PersonaTable& tabla,
+                      const IndiceBitmap& indices, std::string& error) {
+    predicados.clear();
+    bitmaps.clear();
+
+    std::vector<Token> tokens;
+    if (!tokenizar(texto, tokens, error)) {
+        return false;
+    }
+    size_t pos = 0;
+    auto esOperador = [&](const Token& t) {
+        return t.clase == Token::Operador && t.texto != "*" && t.texto != "&&";
+    };
+    auto leerOperador = [&](Op& op) {
+        const Token& t = tokens[pos];
+        if (!esOperador(t)) {
+            error = "se esperaba un operador de comparación y llegó '" + t.texto + "'";
+            return false;
+        }
+        ++pos;
+        if (t.texto == "<") op = Op::Menor;
+        else if (t.texto == "<=") op = Op::MenorIgual;
+        else if (t.texto == ">") op = Op::Mayor;
+        else if (t.texto == ">=") op = Op::MayorIgual;
+        else if (t.texto == "!=" || t.texto == "<>") op = Op::Distinto;
+        else op = Op::Igual;
+        return true;
+    };
+    // a op b  <=>  b op' a (y también al multiplicar por un factor negativo)
+    auto invertir = [](Op op) {
+        switch (op) {
+            case Op::Menor: return Op::Mayor;
+            case Op::MenorIgual: return Op::MayorIgual;
+            case Op::Mayor: return Op::Menor;
+            case Op::MayorIgual: return Op::MenorIgual;
+            default: return op;
+        }
+    };
+    // lado := termino ('*' termino)*, con a lo sumo una columna
+    struct Lado {
+        int columna = -1;
+        double factor = 1;
+    };
+    auto leerLado = [&](Lado& lado) {
+        do {
+            const Token& t = tokens[pos];
+            if (t.clase == Token::Numero) {
+                lado.factor *= t.numero;
+            } else if (t.clase == Token::Palabra && columnaNumerica(t.texto) >= 0) {
+                if (lado.columna >= 0) {
+                    error = "un lado de la comparación solo puede tener una columna";
+                    return false;
+                }
+                lado.columna = columnaNumerica(t.texto);
+            } else {
+                error = t.clase == Token::Fin ? "la expresión termina antes de tiempo"
+                                              : "columna o número inválido: '" + t.texto + "'";
+                return false;
+            }
+            ++pos;
+        } while (tokens[pos].clase == Token::Operador && tokens[pos].texto == "*" && ++pos);
+        return true;
+    };
+
+    do {
+        const Token& t = tokens[pos];
+        std::string palabra = t.clase == Token::Palabra ? minusculas(t.texto) : "";
+        Predicado p;
+
+        if (palabra == "ciudad" || palabra == "ciudadnacimiento") {
+            ++pos;
+            if (!leerOperador(p.op)) {
+                return false;
+            }
+            if (p.op != Op::Igual && p.op != Op::Distinto) {
+                error = "la ciudad solo admite = y !=";
+                return false;
+            }
+            const Token& valor = tokens[pos];
+            if (valor.clase != Token::Palabra && valor.clase != Token::Texto) {
+                error = "se esperaba el nombre de una ciudad";
+                return false;
+            }
+            ++pos;
+            auto it = std::find(ciudadesColombia.begin(), ciudadesColombia.end(), valor.texto);
+            if (it == ciudadesColombia.end()) {
+                error = "ciudad desconocida: '" + valor.texto + "' (use comillas para nombres con espacios)";
+                return false;
+            }
+            size_t codigo = static_cast<size_t>(it - ciudadesColombia.begin());
+            bitmaps.emplace_back();
+            if (codigo < indices.porCiudad.size()) {
+                indices.porCiudad[codigo].expandir(bitmaps.back(), tabla.size());
+            } else {
+                bitmaps.back().assign((tabla.size() + 63) / 64, 0);
+            }
+            p.tipo = Tipo::Bit;
+            p.bitmap = static_cast<int>(bitmaps.size() - 1);
+            p.esperado = p.op == Op::Igual;
+            p.ciudad = valor.texto;
+            size_t marcadas = contarBits(bitmaps.back().data(), bitmaps.back().size());
+            p.pasan = p.esperado ? marcadas : tabla.size() - marcadas;
+        } else if (palabra == "declarante" || palabra == "declaranterenta") {
+            ++pos;
+            p.tipo = Tipo::Bit;
+            p.esperado = true;
+            if (esOperador(tokens[pos])) {
+                if (!leerOperador(p.op) || (p.op != Op::Igual && p.op != Op::Distinto)) {
+                    error = error.empty() ? "declarante solo admite = y !=" : error;
+                    return false;
+                }
+                const Token& valor = tokens[pos];
+                std::string v = minusculas(valor.texto);
+                if (v == "1" || v == "si" || v == "sí" || v == "true") {
+                    p.esperado = true;
+                } else if (v == "0" || v == "no" || v == "false") {
+                    p.esperado = false;
+                } else {
+                    error = "declarante se compara con 1/0 o si/no";
+                    return false;
+                }
+                ++pos;
+                if (p.op == Op::Distinto) {
+                    p.esperado = !p.esperado;
+                }
+            }
+            p.op = Op::Igual;
+            size_t marcadas = contarBits(tabla.declaranteRenta.data(), tabla.declaranteRenta.size());
+            p.pasan = p.esperado ? marcadas : tabla.size() - marcadas;
+        } else {
+            Lado izquierdo, derecho;
+            if (!leerLado(izquierdo) || !leerOperador(p.op) || !leerLado(derecho)) {
+                return false;
+            }
+            if (izquierdo.columna < 0 && derecho.columna < 0) {
+                error = "la comparación no usa ninguna columna";
+                return false;
+            }
+            if (izquierdo.columna < 0) {
+                std::swap(izquierdo, derecho);
+                p.op = invertir(p.op);
+            }
+            if (izquierdo.factor == 0) {
+                error = "la columna está multiplicada por 0";
+                return false;
+            }
+            // col * a op lado  =>  col op lado / a (con a < 0 se invierte el sentido)
+            if (izquierdo.factor < 0) {
+                p.op = invertir(p.op);
+            }
+            p.columna = izquierdo.columna;
+            p.valor = derecho.factor / izquierdo.factor;
+            if (derecho.columna < 0) {
+                p.tipo = Tipo::Constante;
+            } else {
+                p.tipo = Tipo::Columnas;
+                p.otraColumna = derecho.columna;
+            }
+        }
+        predicados.push_back(p);
+
+        const Token& sigue = tokens[pos];
+        std::string conector = minusculas(sigue.texto);
+        if (sigue.clase == Token::Fin) {
+            break;
+        }
+        if ((sigue.clase == Token::Palabra && (conector == "and" || conector == "y"))
+            || (sigue.clase == Token::Operador && conector == "&&")) {
+            ++pos;
+            continue;
+        }
+        error = "se esperaba AND y llegó '" + sigue.texto + "'";
+        return false;
+    } while (true);
+
+    // Orden de evaluación: bits (más selectivo primero), constantes, dos columnas
+    std::stable_sort(predicados.begin(), predicados.end(), [](const Predicado& a, const Predicado& b) {
+        if (a.tipo != b.tipo) {
+            return a.tipo < b.tipo;
+        }
+        return a.tipo == Tipo::Bit && a.pasan < b.pasan;
+    });
+    return true;
+}
+
+size_t Filtro::aplicar(const Predicado& p, const PersonaTable& tabla, uint32_t* sel, size_t k,
+                       uint32_t inicio, uint32_t fin, bool primero) const {
+    if (p.tipo == Tipo::Bit) {
+        const uint64_t* palabras = p.bitmap < 0 ? tabla.declaranteRenta.data() : bitmaps[p.bitmap].data();
+        const uint64_t esperado = p.esperado;
+        return compactar([=](uint32_t i) { return ((palabras[i >> 6] >> (i & 63)) & 1) == esperado; },
+                         sel, k, inicio, fin, primero);
+    }
+    const double* a = datosColumna(tabla, p.columna);
+    const double* b = p.tipo == Tipo::Columnas ? datosColumna(tabla, p.otraColumna) : nullptr;
+    switch (p.op) {
+        case Op::Menor:      return comparar(std::less<double>(), a, b, p.valor, sel, k, inicio, fin, primero);
+        case Op::MenorIgual: return comparar(std::less_equal<double>(), a, b, p.valor, sel, k, inicio, fin, primero);
+        case Op::Mayor:      return comparar(std::greater<double>(), a, b, p.valor, sel, k, inicio, fin, primero);
+        case Op::MayorIgual: return comparar(std::greater_equal<double>(), a, b, p.valor, sel, k, inicio, fin, primero);
+        case Op::Igual:      return comparar(std::equal_to<double>(), a, b, p.valor, sel, k, inicio, fin, primero);
+        case Op::Distinto:   return comparar(std::not_equal_to<double>(), a, b, p.valor, sel, k, inicio, fin, primero);
+    }
+    return 0;
+}
+
+template <typename Salida>
+void Filtro::recorrer(const PersonaTable& tabla, Salida salida) const {
+    const size_t n = tabla.size();
+    uint32_t sel[LOTE];
+    for (size_t inicio = 0; inicio < n; inicio += LOTE) {
+        uint32_t fin = static_cast<uint32_t>(std::min(n, inicio + LOTE));
+        size_t k = fin - inicio;
+        if (predicados.empty()) {
+            for (uint32_t i = static_cast<uint32_t>(inicio); i < fin; ++i) {
+                sel[i - inicio] = i;
+            }
+        }
+        for (size_t p = 0; p < predicados.size() && k > 0; ++p) {
+            k = aplicar(predicados[p], tabla, sel, k, static_cast<uint32_t>(inicio), fin, p == 0);
+        }
+        if (k > 0) {
+            salida(sel, k);
+        }
+    }
+}
+
+size_t Filtro::contar(const PersonaTable& tabla) const {
+    size_t total = 0;
+    recorrer(tabla, [&](const uint32_t*, size_t k) { total += k; });
+    return total;
+}
+
+void Filtro::seleccionar(const PersonaTable& tabla, std::vector<uint32_t>& salida) const {
+    salida.clear();
+    recorrer(tabla, [&](const uint32_t* sel, size_t k) { salida.insert(salida.end(), sel, sel + k); });
+}
+
+size_t Filtro::contarFilaPorFila(const PersonaTable& tabla) const {
+    size_t total = 0;
+    for (size_t i = 0; i < tabla.size(); ++i) {
+        bool cumple = true;
+        for (size_t p = 0; p < predicados.size() && cumple; ++p) {
+            const Predicado& pr = predicados[p];
+            if (pr.tipo == Tipo::Bit) {
+                bool bit = pr.bitmap < 0 ? tabla.esDeclarante(i) : tabla.ciudadNacimiento[i] == pr.ciudad;
+                cumple = bit == pr.esperado;
+                continue;
+            }
+            double a = datosColumna(tabla, pr.columna)[i];
+            double b = pr.tipo == Tipo::Columnas ? datosColumna(tabla, pr.otraColumna)[i] * pr.valor : pr.valor;
+            switch (pr.op) {
+                case Op::Menor:      cumple = a < b; break;
+                case Op::MenorIgual: cumple = a <= b; break;
+                case Op::Mayor:      cumple = a > b; break;
+                case Op::MayorIgual: cumple = a >= b; break;
+                case Op::Igual:      cumple = a == b; break;
+                case Op::Distinto:   cumple = a != b; break;
+            }
+        }
+        total += cumple;
+    }
+    return total;
+}
+
+std::string Filtro::descripcion() const {
+    static const char* const OPERADORES[] = {"<", "<=", ">", ">=", "=", "!="};
+    std::ostringstream s;
+    for (size_t p = 0; p < predicados.size(); ++p) {
+        const Predicado& pr = predicados[p];
+        s << (p ? " AND " : "");
+        if (pr.tipo == Tipo::Bit) {
+            s << (pr.bitmap < 0 ? "declarante" : "ciudad") << (pr.esperado ? " = " : " != ")
+              << (pr.bitmap < 0 ? "1" : "'" + pr.ciudad + "'") << " [bit, " << pr.pasan << " filas]";
+        } else {
+            s << NOMBRES_COLUMNA[pr.columna] << " " << OPERADORES[static_cast<int>(pr.op)] << " ";
+            if (pr.tipo == Tipo::Columnas) {
+                s << NOMBRES_COLUMNA[pr.otraColumna] << " * ";
+            }
+            s << pr.valor;
+        }
+    }
+    return s.str();
+}
@@ -0,0 +1,85 @@
+#ifndef FILTRO_H
+#define FILTRO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "persona_tabla.h"
+#include "indice_bitmap.h"
+
+// Filtros ad hoc sobre la tabla columnar, escritos como expresiones:
+//
+//   filtro      := comparacion (AND comparacion)*     AND también puede ser Y o &&
+//   comparacion := lado op lado
+//                | ciudad (= | !=) Cali               o "Santa Marta" entre comillas
+//                | declarante [(= | !=) 1|0|si|no]
+//   lado        := termino ('*' termino)*             a lo sumo una columna por lado
+//   termino     := número | ingresos | patrimonio | deudas
+//   op          := = == != <> < <= > >=
+//
+// Ejemplo: ciudad = Cali AND ingresos > 1e8 AND deudas < patrimonio * 0.2
+//
+// compilar() normaliza cada comparación a una de tres formas:
+//   - columna op constante
+//   - columna op otraColumna * k
+//   - prueba de un bit (declarante, o ciudad con su bitmap expandido a un mapa plano)
+// y las ordena: primero los bits (los más selectivos antes), luego las comparaciones
+// con constante y al final las de dos columnas.
+//
+// La evaluación es una sola pasada por lotes de LOTE filas: el primer predicado llena
+// un vector de selección con los ids del lote que lo cumplen y cada predicado siguiente
+// lo compacta en sitio, leyendo solo las filas que siguen vivas. Las escrituras son
+// incondicionales (sel[m] = i; m += cumple), así el bucle no tiene saltos que dependan
+// de los datos.
+class Filtro {
+public:
+    static const size_t LOTE = 1024; // Filas por lote: el vector de selección (4 KB) cabe en L1
+
+    // Compila 'texto' para 'tabla'. Si la expresión no es válida devuelve false
+    // y explica el motivo en 'error'.
+    bool compilar(const std::string& texto, const PersonaTable& tabla,
+                  const IndiceBitmap& indices, std::string& error);
+
+    // Número de filas que cumplen el filtro
+    size_t contar(const PersonaTable& tabla) const;
+
+    // Vector de selección: ids de las filas que cumplen, en orden creciente
+    void seleccionar(const PersonaTable& tabla, std::vector<uint32_t>& salida) const;
+
+    // Referencia: el bucle escrito a mano, fila por fila, con cortocircuito y
+    // comparando el texto de la ciudad
+    size_t contarFilaPorFila(const PersonaTable& tabla) const;
+
+    std::string descripcion() const; // Predicados en orden de evaluación
+    size_t numPredicados() const { return predicados.size(); }
+
+private:
+    enum class Op { Menor, MenorIgual, Mayor, MayorIgual, Igual, Distinto };
+    enum class Tipo { Bit, Constante, Columnas }; // También el orden de evaluación
+
+    struct Predicado {
+        Tipo tipo;
+        Op op = Op::Igual;
+        int columna = 0;       // Constante / Columnas: 0 ingresos, 1 patrimonio, 2 deudas
+        int otraColumna = 0;   // Columnas
+        double valor = 0;      // Constante: la constante; Columnas: el factor k
+        int bitmap = -1;       // Bit: posición en 'bitmaps' (-1 = declarantes de la tabla)
+        bool esperado = true;  // Bit: valor que debe tener el bit
+        size_t pasan = 0;      // Bit: filas que cumplen (para ordenar por selectividad)
+        std::string ciudad;    // Bit de ciudad: texto (para la referencia fila por fila)
+    };
+
+    // Aplica un predicado a un lote; devuelve cuántas filas siguen en 'sel'
+    size_t aplicar(const Predicado& p, const PersonaTable& tabla, uint32_t* sel, size_t k,
+                   uint32_t inicio, uint32_t fin, bool primero) const;
+
+    // Recorre la tabla por lotes y entrega a 'salida' cada vector de selección no vacío
+    template <typename Salida>
+    void recorrer(const PersonaTable& tabla, Salida salida) const;
+
+    std::vector<Predicado> predicados;
+    std::vector<std::vector<uint64_t>> bitmaps; // Ciudades expandidas (bit i = fila i)
+};
+
+#endif // FILTRO_H
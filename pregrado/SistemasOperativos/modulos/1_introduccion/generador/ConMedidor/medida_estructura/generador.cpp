@@ -61,6 +61,11 @@ double randomDouble(double min, double max) {
 }
 
 Persona generarPersona() {
+    int codigoCiudad;
+    return generarPersona(codigoCiudad);
+}
+
+Persona generarPersona(int& codigoCiudad) {
     Persona p; // Crea una instancia de la estructura Persona
     
     // Decide aleatoriamente si es hombre o mujer
@@ -77,8 +82,9 @@ Persona generarPersona() {
     
     // Genera identificadores únicos
     p.id = generarID();
-    // Ciudad aleatoria de Colombia
-    p.ciudadNacimiento = ciudadesColombia[rand() % ciudadesColombia.size()];
+    // Ciudad aleatoria de Colombia (se conserva el código para los índices)
+    codigoCiudad = rand() % ciudadesColombia.size();
+    p.ciudadNacimiento = ciudadesColombia[codigoCiudad];
     // Fecha aleatoria
     p.fechaNacimiento = generarFechaNacimiento();
     
@@ -95,25 +101,35 @@ Persona generarPersona() {
     return p; // Retorna la estructura completa
 }
 
-std::vector<Persona> generarColeccion(int n) {
-    std::vector<Persona> personas;
-    // Reserva espacio para n personas (optimización)
+PersonaTable generarColeccion(int n, IndiceBitmap* indices) {
+    PersonaTable personas;
+    // Reserva espacio para n filas en cada columna (optimización)
     personas.reserve(n);
+    if (indices) {
+        indices->preparar(ciudadesColombia.size());
+    }
     
-    // Genera n personas y las añade al vector
+    // Genera n personas y reparte sus campos en las columnas
     for (int i = 0; i < n; ++i) {
-        personas.push_back(generarPersona());
+        int codigoCiudad;
+        Persona p = generarPersona(codigoCiudad);
+        if (indices) {
+            // Los índices se mantienen mientras se genera, sin otra pasada
+            indices->agregar(i, codigoCiudad, p.declaranteRenta);
+        }
+        personas.agregar(std::move(p));
     }
     
     return personas;
 }
 
-const Persona* buscarPorID(const std::vector<Persona>& personas, const std::string& id) {
-    // Búsqueda lineal por ID (solución simple para colecciones medianas)
-    for (const auto& persona : personas) {
-        if (persona.id == id) { // Acceso directo al campo id
-            return &persona; // Retorna dirección si encuentra coincidencia
+long buscarPorID(const PersonaTable& personas, const std::string& id) {
+    // Búsqueda lineal recorriendo solo la columna de IDs
+    const size_t tam = personas.size();
+    for (size_t i = 0; i < tam; ++i) {
+        if (personas.id[i] == id) {
+            return static_cast<long>(i); // Retorna la fila si encuentra coincidencia
         }
     }
-    return nullptr; // Retorna nulo si no encuentra
+    return -1; // Retorna -1 si no encuentra
 }
\ No newline at end of file
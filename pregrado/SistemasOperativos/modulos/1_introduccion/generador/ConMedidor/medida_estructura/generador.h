@@ -2,8 +2,13 @@
 #define GENERADOR_H
 
 #include "persona.h"
+#include "persona_tabla.h"
+#include "indice_bitmap.h"
 #include <vector>
 
+// Vocabulario fijo de ciudades (el código de ciudad es la posición en este vector)
+extern const std::vector<std::string> ciudadesColombia;
+
 // --- Funciones para generación de datos aleatorios ---
 
 // Genera fecha aleatoria entre 1960-2010
@@ -18,11 +23,15 @@ double randomDouble(double min, double max);
 // Crea una persona con datos aleatorios
 Persona generarPersona();
 
-// Genera colección de n personas
-std::vector<Persona> generarColeccion(int n);
+// Igual que generarPersona(), y además devuelve el código de la ciudad elegida
+Persona generarPersona(int& codigoCiudad);
+
+// Genera colección de n personas directamente en formato columnar
+// Si se pasa 'indices', el generador también llena los bitmaps por ciudad y declarante
+PersonaTable generarColeccion(int n, IndiceBitmap* indices = nullptr);
 
-// Busca persona por ID en un vector
-// Retorna puntero a persona si la encuentra, nullptr si no
-const Persona* buscarPorID(const std::vector<Persona>& personas, const std::string& id);
+// Busca persona por ID en la tabla
+// Retorna la fila si la encuentra, -1 si no
+long buscarPorID(const PersonaTable& personas, const std::string& id);
 
 #endif // GENERADOR_H
\ No newline at end of file
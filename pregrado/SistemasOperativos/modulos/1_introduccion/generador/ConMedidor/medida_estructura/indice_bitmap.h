@@ -0,0 +1,244 @@
+#ifndef INDICE_BITMAP_H
+#define INDICE_BITMAP_H
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+// Bitmap comprimido por bloques de 65536 filas (esquema tipo Roaring).
+// Cada bloque se guarda como:
+//  - arreglo ordenado de posiciones de 16 bits si tiene pocas filas (<= 4096)
+//  - mapa de bits de 1024 palabras de 64 bits si es denso
+// Así una ciudad (~5% de las filas) ocupa menos que un bitmap plano y el
+// declarante (~60%) se opera palabra a palabra con AND + popcount.
+class BitmapComprimido {
+public:
+    static const uint32_t FILAS_BLOQUE = 65536;
+    static const uint32_t PALABRAS_BLOQUE = FILAS_BLOQUE / 64;
+    static const uint32_t LIMITE_ARREGLO = 4096; // Por encima conviene el mapa de bits
+
+    // Añade una fila; las filas deben llegar en orden creciente (generación secuencial)
+    void agregar(uint32_t fila);
+
+    size_t contar() const;                        // Número de filas marcadas
+    size_t memoria_bytes() const;                 // Tamaño de los bloques en bytes
+    void filas(std::vector<uint32_t>& salida, size_t limite) const; // Primeras 'limite' filas
+    // Copia el bitmap a un mapa de bits plano de numFilas bits (bit i = fila i)
+    void expandir(std::vector<uint64_t>& palabras, size_t numFilas) const;
+    void limpiar() { bloques.clear(); }
+
+    // Intersección (AND) de dos bitmaps
+    static BitmapComprimido interseccion(const BitmapComprimido& a, const BitmapComprimido& b);
+    // Cuenta la intersección sin materializarla
+    static size_t contarInterseccion(const BitmapComprimido& a, const BitmapComprimido& b);
+
+private:
+    struct Bloque {
+        bool denso = false;
+        uint32_t cardinalidad = 0;
+        std::vector<uint16_t> arreglo; // Posiciones ordenadas (modo disperso)
+        std::vector<uint64_t> bits;    // PALABRAS_BLOQUE palabras (modo denso)
+
+        void densificar();
+    };
+
+    static Bloque interseccionBloques(const Bloque& a, const Bloque& b);
+    static uint32_t contarBloques(const Bloque& a, const Bloque& b);
+
+    std::vector<Bloque> bloques; // Bloque k cubre las filas [k*65536, (k+1)*65536)
+};
+
+// Índices secundarios mantenidos por el generador:
+// un bitmap por ciudad de nacimiento y uno para declaranteRenta.
+struct IndiceBitmap {
+    std::vector<BitmapComprimido> porCiudad; // Posición = código de ciudad
+    BitmapComprimido declarantes;
+
+    void preparar(size_t numCiudades) {
+        porCiudad.assign(numCiudades, BitmapComprimido());
+        declarantes.limpiar();
+    }
+
+    void agregar(uint32_t fila, int ciudad, bool declarante) {
+        porCiudad[ciudad].agregar(fila);
+        if (declarante) {
+            declarantes.agregar(fila);
+        }
+    }
+
+    size_t memoria_bytes() const {
+        size_t total = declarantes.memoria_bytes();
+        for (const auto& b : porCiudad) {
+            total += b.memoria_bytes();
+        }
+        return total;
+    }
+};
+
+// --- Implementación inline ---
+
+inline void BitmapComprimido::Bloque::densificar() {
+    bits.assign(PALABRAS_BLOQUE, 0);
+    for (uint16_t pos : arreglo) {
+        bits[pos >> 6] |= uint64_t(1) << (pos & 63);
+    }
+    std::vector<uint16_t>().swap(arreglo);
+    denso = true;
+}
+
+inline void BitmapComprimido::agregar(uint32_t fila) {
+    uint32_t k = fila / FILAS_BLOQUE;
+    uint16_t pos = static_cast<uint16_t>(fila % FILAS_BLOQUE);
+    if (bloques.size() <= k) {
+        bloques.resize(k + 1);
+    }
+    Bloque& b = bloques[k];
+    if (b.denso) {
+        b.bits[pos >> 6] |= uint64_t(1) << (pos & 63);
+    } else {
+        b.arreglo.push_back(pos);
+        if (b.arreglo.size() > LIMITE_ARREGLO) {
+            b.densificar();
+        }
+    }
+    ++b.cardinalidad;
+}
+
+inline size_t BitmapComprimido::contar() const {
+    size_t total = 0;
+    for (const auto& b : bloques) {
+        total += b.cardinalidad;
+    }
+    return total;
+}
+
+inline size_t BitmapComprimido::memoria_bytes() const {
+    size_t total = bloques.capacity() * sizeof(Bloque);
+    for (const auto& b : bloques) {
+        total += b.arreglo.capacity() * sizeof(uint16_t) + b.bits.capacity() * sizeof(uint64_t);
+    }
+    return total;
+}
+
+inline void BitmapComprimido::filas(std::vector<uint32_t>& salida, size_t limite) const {
+    for (size_t k = 0; k < bloques.size() && salida.size() < limite; ++k) {
+        const Bloque& b = bloques[k];
+        uint32_t base = static_cast<uint32_t>(k * FILAS_BLOQUE);
+        if (b.denso) {
+            for (uint32_t w = 0; w < PALABRAS_BLOQUE && salida.size() < limite; ++w) {
+                uint64_t palabra = b.bits[w];
+                while (palabra && salida.size() < limite) {
+                    salida.push_back(base + w * 64 + __builtin_ctzll(palabra));
+                    palabra &= palabra - 1; // Apaga el bit más bajo
+                }
+            }
+        } else {
+            for (size_t i = 0; i < b.arreglo.size() && salida.size() < limite; ++i) {
+                salida.push_back(base + b.arreglo[i]);
+            }
+        }
+    }
+}
+
+inline void BitmapComprimido::expandir(std::vector<uint64_t>& palabras, size_t numFilas) const {
+    palabras.assign((numFilas + 63) / 64, 0);
+    for (size_t k = 0; k < bloques.size(); ++k) {
+        const Bloque& b = bloques[k];
+        size_t base = k * PALABRAS_BLOQUE; // Los bloques empiezan en múltiplos de 64 filas
+        if (b.denso) {
+            for (uint32_t w = 0; w < PALABRAS_BLOQUE && base + w < palabras.size(); ++w) {
+                palabras[base + w] = b.bits[w];
+            }
+        } else {
+            for (uint16_t pos : b.arreglo) {
+                if (base + (pos >> 6) < palabras.size()) {
+                    palabras[base + (pos >> 6)] |= uint64_t(1) << (pos & 63);
+                }
+            }
+        }
+    }
+}
+
+inline BitmapComprimido::Bloque BitmapComprimido::interseccionBloques(const Bloque& a, const Bloque& b) {
+    Bloque r;
+    if (a.denso && b.denso) {
+        // Caso palabra a palabra: AND + popcount
+        r.bits.resize(PALABRAS_BLOQUE);
+        uint32_t card = 0;
+        for (uint32_t w = 0; w < PALABRAS_BLOQUE; ++w) {
+            r.bits[w] = a.bits[w] & b.bits[w];
+            card += __builtin_popcountll(r.bits[w]);
+        }
+        r.denso = true;
+        r.cardinalidad = card;
+        if (card <= LIMITE_ARREGLO) {
+            // Vuelve a modo disperso si quedaron pocas filas
+            for (uint32_t w = 0; w < PALABRAS_BLOQUE; ++w) {
+                for (uint64_t p = r.bits[w]; p; p &= p - 1) {
+                    r.arreglo.push_back(static_cast<uint16_t>(w * 64 + __builtin_ctzll(p)));
+                }
+            }
+            std::vector<uint64_t>().swap(r.bits);
+            r.denso = false;
+        }
+    } else if (a.denso || b.denso) {
+        // Disperso contra denso: prueba cada posición en el mapa de bits
+        const Bloque& disperso = a.denso ? b : a;
+        const Bloque& denso = a.denso ? a : b;
+        for (uint16_t pos : disperso.arreglo) {
+            if ((denso.bits[pos >> 6] >> (pos & 63)) & 1) {
+                r.arreglo.push_back(pos);
+            }
+        }
+        r.cardinalidad = static_cast<uint32_t>(r.arreglo.size());
+    } else {
+        // Disperso contra disperso: mezcla de arreglos ordenados
+        std::set_intersection(a.arreglo.begin(), a.arreglo.end(),
+                              b.arreglo.begin(), b.arreglo.end(),
+                              std::back_inserter(r.arreglo));
+        r.cardinalidad = static_cast<uint32_t>(r.arreglo.size());
+    }
+    return r;
+}
+
+inline uint32_t BitmapComprimido::contarBloques(const Bloque& a, const Bloque& b) {
+    if (a.denso && b.denso) {
+        uint32_t card = 0;
+        for (uint32_t w = 0; w < PALABRAS_BLOQUE; ++w) {
+            card += __builtin_popcountll(a.bits[w] & b.bits[w]);
+        }
+        return card;
+    }
+    if (a.denso || b.denso) {
+        const Bloque& disperso = a.denso ? b : a;
+        const Bloque& denso = a.denso ? a : b;
+        uint32_t card = 0;
+        for (uint16_t pos : disperso.arreglo) {
+            card += (denso.bits[pos >> 6] >> (pos & 63)) & 1;
+        }
+        return card;
+    }
+    return interseccionBloques(a, b).cardinalidad;
+}
+
+inline BitmapComprimido BitmapComprimido::interseccion(const BitmapComprimido& a, const BitmapComprimido& b) {
+    BitmapComprimido r;
+    size_t n = std::min(a.bloques.size(), b.bloques.size());
+    r.bloques.resize(n);
+    for (size_t k = 0; k < n; ++k) {
+        r.bloques[k] = interseccionBloques(a.bloques[k], b.bloques[k]);
+    }
+    return r;
+}
+
+inline size_t BitmapComprimido::contarInterseccion(const BitmapComprimido& a, const BitmapComprimido& b) {
+    size_t total = 0;
+    size_t n = std::min(a.bloques.size(), b.bloques.size());
+    for (size_t k = 0; k < n; ++k) {
+        total += contarBloques(a.bloques[k], b.bloques[k]);
+    }
+    return total;
+}
+
+#endif // INDICE_BITMAP_H
@@ -3,7 +3,12 @@
 #include <limits> // Para manejo de límites de entrada
 #include <memory> // Para std::unique_ptr y std::make_unique
 #include "persona.h"
+#include "persona_tabla.h"
+#include "indice_bitmap.h"
+#include "agregados.h"
 #include "generador.h"
+#include "filtro.h"
+#include "almacen_comprimido.h"
 #include "monitor.h" // Nuevo header para monitoreo
 
 void mostrarMenu() {
@@ -14,15 +19,21 @@ void mostrarMenu() {
     std::cout << "\n3. Buscar persona por ID";
     std::cout << "\n4. Mostrar estadísticas de rendimiento";
     std::cout << "\n5. Exportar estadísticas a CSV";
-    std::cout << "\n6. Salir";
+    std::cout << "\n6. Filtrar por ciudad y declarante (índices bitmap)";
+    std::cout << "\n7. Estadísticas financieras (SIMD)";
+    std::cout << "\n8. Filtrar con expresión (escaneo fusionado)";
+    std::cout << "\n9. Almacén comprimido vs vector de Persona";
+    std::cout << "\n10. Salir";
     std::cout << "\nSeleccione una opción: ";
 }
 
 int main() {
     srand(time(nullptr));
     
-    // Usar unique_ptr para manejar la colección de personas
-    std::unique_ptr<std::vector<Persona>> personas = nullptr;
+    // Usar unique_ptr para manejar la tabla columnar de personas
+    std::unique_ptr<PersonaTable> personas = nullptr;
+    // Bitmaps por ciudad y declarante, llenados por el generador
+    IndiceBitmap indices;
     Monitor monitor;
     
     int opcion;
@@ -50,7 +61,7 @@ int main() {
                 }
                 
                 // Generar el nuevo conjunto de datos
-                personas = std::make_unique<std::vector<Persona>>(generarColeccion(n));
+                personas = std::make_unique<PersonaTable>(generarColeccion(n, &indices));
                 tam = personas->size();
                 
                 double tiempo_gen = monitor.detener_tiempo();
@@ -58,6 +69,7 @@ int main() {
                 
                 std::cout << "Generadas " << tam << " personas en " 
                           << tiempo_gen << " ms, Memoria: " << memoria_gen << " KB\n";
+                std::cout << "Índices bitmap: " << indices.memoria_bytes() / 1024 << " KB\n";
                 
                 monitor.registrar("Crear datos", tiempo_gen, memoria_gen);
                 break;
@@ -73,7 +85,7 @@ int main() {
                 std::cout << "\n=== RESUMEN DE PERSONAS (" << tam << ") ===\n";
                 for(size_t i = 0; i < tam; ++i) {
                     std::cout << i << ". ";
-                    (*personas)[i].mostrarResumen();
+                    personas->mostrarResumen(i);
                     std::cout << "\n";
                 }
                 
@@ -93,7 +105,7 @@ int main() {
                 std::cout << "\nIngrese el índice (0-" << tam-1 << "): ";
                 if(std::cin >> indice) {
                     if(indice >= 0 && static_cast<size_t>(indice) < tam) {
-                        (*personas)[indice].mostrar();
+                        personas->mostrar(indice);
                     } else {
                         std::cout << "Índice fuera de rango!\n";
                     }
@@ -118,8 +130,9 @@ int main() {
                 std::cout << "\nIngrese el ID a buscar: ";
                 std::cin >> idBusqueda;
                 
-                if(const Persona* encontrada = buscarPorID(*personas, idBusqueda)) {
-                    encontrada->mostrar();
+                long fila = buscarPorID(*personas, idBusqueda);
+                if(fila >= 0) {
+                    personas->mostrar(fila);
                 } else {
                     std::cout << "No se encontró persona con ID " << idBusqueda << "\n";
                 }
@@ -138,7 +151,375 @@ int main() {
                 monitor.exportar_csv();
                 break;
                 
-            case 6:
+            case 6: {
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                // Elegir ciudad (0 = todas)
+                std::cout << "\nCiudades:";
+                for (size_t c = 0; c < ciudadesColombia.size(); ++c) {
+                    std::cout << "\n  " << c + 1 << ". " << ciudadesColombia[c];
+                }
+                int ciudad;
+                char soloDeclarantes;
+                std::cout << "\nIngrese la ciudad (0 = todas): ";
+                std::cin >> ciudad;
+                std::cout << "¿Solo declarantes de renta? (s/n): ";
+                std::cin >> soloDeclarantes;
+                
+                if (ciudad < 0 || static_cast<size_t>(ciudad) > ciudadesColombia.size()) {
+                    std::cout << "Ciudad fuera de rango!\n";
+                    break;
+                }
+                bool filtrarDeclarante = (soloDeclarantes == 's' || soloDeclarantes == 'S');
+                
+                // Filtro conjuntivo resuelto solo con los bitmaps (sin leer las filas)
+                const size_t LIMITE_FILAS = 20;
+                size_t total;
+                std::vector<uint32_t> filas;
+                if (ciudad > 0 && filtrarDeclarante) {
+                    BitmapComprimido resultado = BitmapComprimido::interseccion(
+                        indices.porCiudad[ciudad - 1], indices.declarantes);
+                    total = resultado.contar();
+                    resultado.filas(filas, LIMITE_FILAS);
+                } else if (ciudad > 0) {
+                    total = indices.porCiudad[ciudad - 1].contar();
+                    indices.porCiudad[ciudad - 1].filas(filas, LIMITE_FILAS);
+                } else if (filtrarDeclarante) {
+                    total = indices.declarantes.contar();
+                    indices.declarantes.filas(filas, LIMITE_FILAS);
+                } else {
+                    total = personas->size();
+                    for (size_t i = 0; i < total && i < LIMITE_FILAS; ++i) {
+                        filas.push_back(static_cast<uint32_t>(i));
+                    }
+                }
+                
+                std::cout << "\nCoincidencias: " << total << "\nFilas:";
+                for (uint32_t f : filas) {
+                    std::cout << " " << f;
+                }
+                if (total > filas.size()) {
+                    std::cout << " ... (" << total - filas.size() << " más)";
+                }
+                std::cout << "\n";
+                
+                double tiempo_filtro = monitor.detener_tiempo();
+                long memoria_filtro = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Filtro bitmap", tiempo_filtro, memoria_filtro);
+                break;
+            }
+                
+            case 7: {
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                tam = personas->size();
+                NivelSimd nivel = nivelSimdDisponible();
+                std::cout << "\n=== ESTADÍSTICAS FINANCIERAS (" << tam << " personas, "
+                          << nombreNivel(nivel) << ") ===\n";
+                
+                // Cada métrica es una reducción sobre columnas contiguas de double
+                struct Metrica {
+                    const char* nombre;
+                    const double* a;
+                    const double* b; // Sustraendo (nullptr si la métrica es una sola columna)
+                };
+                const Metrica metricas[] = {
+                    {"Ingresos anuales", personas->ingresosAnuales.data(), nullptr},
+                    {"Patrimonio", personas->patrimonio.data(), nullptr},
+                    {"Deudas", personas->deudas.data(), nullptr},
+                    {"Patrimonio neto", personas->patrimonio.data(), personas->deudas.data()},
+                };
+                std::cout << std::fixed << std::setprecision(2);
+                for (const auto& m : metricas) {
+                    monitor.iniciar_tiempo();
+                    ResumenColumna r = m.b ? resumirDiferencia(m.a, m.b, tam) : resumirColumna(m.a, tam);
+                    double tiempo_metrica = monitor.detener_tiempo();
+                    
+                    std::cout << "\n" << m.nombre << ":\n"
+                              << "   - Total: $" << r.suma << "\n"
+                              << "   - Media: $" << r.media() << "\n"
+                              << "   - Mínimo: $" << r.minimo << "\n"
+                              << "   - Máximo: $" << r.maximo << "\n";
+                    monitor.registrar_recorrido(std::string("Agregado ") + m.nombre, tiempo_metrica, 0,
+                                                tam * sizeof(double) * (m.b ? 2 : 1));
+                }
+                
+                // Proporción de declarantes: conteo de bits del bitmap empaquetado
+                monitor.iniciar_tiempo();
+                size_t declarantes = contarBits(personas->declaranteRenta.data(),
+                                                personas->declaranteRenta.size());
+                double tiempo_bits = monitor.detener_tiempo();
+                std::cout << "\nDeclarantes de renta: " << declarantes << " de " << tam
+                          << " (" << 100.0 * declarantes / tam << "%)\n";
+                monitor.registrar_recorrido("Conteo declarantes", tiempo_bits, 0,
+                                            personas->declaranteRenta.size() * sizeof(uint64_t));
+                
+                // Referencia: el mismo recorrido con cada nivel de instrucciones
+                std::cout << "\nComparación de niveles (ingresos anuales):\n";
+                for (NivelSimd n : {NivelSimd::AVX2, NivelSimd::SSE2, NivelSimd::Escalar}) {
+                    if (n == NivelSimd::AVX2 && nivel != NivelSimd::AVX2) {
+                        continue; // La CPU no soporta AVX2
+                    }
+                    if (n != NivelSimd::Escalar && nivel == NivelSimd::Escalar) {
+                        continue; // Plataforma sin núcleos vectoriales
+                    }
+                    monitor.iniciar_tiempo();
+                    volatile double suma = resumirColumna(personas->ingresosAnuales.data(), tam, n).suma;
+                    (void)suma;
+                    double tiempo_nivel = monitor.detener_tiempo();
+                    std::cout << "   - " << nombreNivel(n) << ": " << tiempo_nivel << " ms, "
+                              << (tam * sizeof(double) / 1e9) / (tiempo_nivel / 1000.0) << " GB/s\n";
+                }
+                break;
+            }
+                
+            case 8: {
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+                
+                std::cout << "\nColumnas: ingresos, patrimonio, deudas, ciudad, declarante"
+                          << "\nEjemplo: ciudad = Cali AND ingresos > 1e8 AND deudas < patrimonio * 0.2"
+                          << "\nFiltro: ";
+                std::string texto;
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                std::getline(std::cin, texto);
+                
+                Filtro filtro;
+                std::string error;
+                if (!filtro.compilar(texto, *personas, indices, error)) {
+                    std::cout << "Filtro inválido: " << error << "\n";
+                    break;
+                }
+                std::cout << "Plan (" << filtro.numPredicados() << " predicados): "
+                          << filtro.descripcion() << "\n";
+                
+                int resultado;
+                std::cout << "Resultado (1. Conteo, 2. Vector de selección): ";
+                std::cin >> resultado;
+                
+                // Una sola pasada por lotes sobre las columnas involucradas
+                tam = personas->size();
+                size_t total;
+                std::vector<uint32_t> filas;
+                monitor.iniciar_tiempo();
+                if (resultado == 2) {
+                    filtro.seleccionar(*personas, filas);
+                    total = filas.size();
+                } else {
+                    total = filtro.contar(*personas);
+                }
+                double tiempo_filtro = monitor.detener_tiempo();
+                monitor.registrar_filas(resultado == 2 ? "Filtro fusionado (selección)" : "Filtro fusionado (conteo)",
+                                        tiempo_filtro, monitor.obtener_memoria() - memoria_inicio, tam);
+                
+                // Referencia: el mismo filtro evaluado fila por fila
+                monitor.iniciar_tiempo();
+                size_t totalReferencia = filtro.contarFilaPorFila(*personas);
+                double tiempo_referencia = monitor.detener_tiempo();
+                monitor.registrar_filas("Filtro fila por fila", tiempo_referencia, 0, tam);
+                
+                std::cout << "\nCoincidencias: " << total << " de " << tam;
+                if (total != totalReferencia) {
+                    std::cout << " (ERROR: la referencia fila por fila da " << totalReferencia << ")";
+                }
+                if (resultado == 2) {
+                    const size_t LIMITE_FILAS = 20;
+                    std::cout << "\nFilas:";
+                    for (size_t i = 0; i < filas.size() && i < LIMITE_FILAS; ++i) {
+                        std::cout << " " << filas[i];
+                    }
+                    if (filas.size() > LIMITE_FILAS) {
+                        std::cout << " ... (" << filas.size() - LIMITE_FILAS << " más)";
+                    }
+                }
+                std::cout << "\n";
+                break;
+            }
+                
+            case 9: {
+                long long n;
+                char respuesta;
+                std::cout << "\nNúmero de personas para el almacén comprimido: ";
+                std::cin >> n;
+                std::cout << "¿Generar también el vector<Persona> para comparar? (s/n): ";
+                std::cin >> respuesta;
+                if (n <= 0) {
+                    std::cout << "Error: Debe generar al menos 1 persona\n";
+                    break;
+                }
+                bool conVector = (respuesta == 's' || respuesta == 'S');
+                
+                // Generación en flujo: cada persona se comprime al llegar, así el almacén
+                // nunca necesita la colección completa sin comprimir
+                AlmacenComprimido almacen;
+                almacen.reservar(n);
+                std::vector<Persona> plano;
+                if (conVector) {
+                    plano.reserve(n);
+                }
+                size_t rechazadas = 0;
+                monitor.iniciar_tiempo();
+                for (long long i = 0; i < n; ++i) {
+                    Persona p = generarPersona();
+                    rechazadas += !almacen.agregar(p);
+                    if (conVector) {
+                        plano.push_back(std::move(p));
+                    }
+                }
+                double tiempo_gen = monitor.detener_tiempo();
+                monitor.registrar_filas("Generar almacén comprimido", tiempo_gen, 0, n);
+                
+                // Bytes por registro: el vector cuenta sizeof(Persona) y el texto que no cabe en el string
+                const std::string vacio;
+                auto bytesTexto = [&](const std::string& t) {
+                    return t.capacity() > vacio.capacity() ? t.capacity() + 1 : 0;
+                };
+                size_t bytesPlano = plano.capacity() * sizeof(Persona);
+                for (const auto& p : plano) {
+                    bytesPlano += bytesTexto(p.nombre) + bytesTexto(p.apellido) + bytesTexto(p.id)
+                                + bytesTexto(p.ciudadNacimiento) + bytesTexto(p.fechaNacimiento);
+                }
+                
+                std::cout << "\n=== ALMACÉN COMPRIMIDO (" << almacen.size() << " personas, "
+                          << almacen.numBloques() << " bloques de " << AlmacenComprimido::BLOQUE << ") ===\n"
+                          << std::fixed << std::setprecision(2)
+                          << "Diccionarios: " << almacen.nombres().size() << " nombres, "
+                          << almacen.apellidos().size() << " apellidos, " << almacen.ciudades().size() << " ciudades\n"
+                          << "Comprimido: " << static_cast<double>(almacen.memoria_bytes()) / n << " bytes/registro ("
+                          << almacen.memoria_bytes() / (1024 * 1024) << " MB; los tres double y el bit de declarante son "
+                          << 3 * sizeof(double) + 1.0 / 8 << ")\n";
+                if (conVector) {
+                    std::cout << "vector<Persona>: " << static_cast<double>(bytesPlano) / n << " bytes/registro ("
+                              << bytesPlano / (1024 * 1024) << " MB)\n";
+                }
+                if (rechazadas > 0) {
+                    std::cout << "Personas no admitidas (id o fecha con otro formato): " << rechazadas << "\n";
+                }
+                for (size_t i = 0; i < almacen.size() && i < 3; ++i) {
+                    almacen.obtener(i).mostrarResumen();
+                    std::cout << "\n";
+                }
+                
+                // Recorridos: el almacén descomprime un bloque a la vez y solo los campos pedidos
+                const std::string ciudad = "Cali";
+                const int desdeAnio = 1990;
+                auto medir = [&](const std::string& nombre, auto recorrido) {
+                    monitor.iniciar_tiempo();
+                    double control = recorrido();
+                    double tiempo = monitor.detener_tiempo();
+                    monitor.registrar_filas(nombre, tiempo, 0, n);
+                    return control;
+                };
+                auto comparar = [&](const std::string& titulo, double comprimido, double vector, bool entero) {
+                    std::cout << titulo << ": ";
+                    if (entero) {
+                        std::cout << static_cast<unsigned long long>(comprimido);
+                    } else {
+                        std::cout << comprimido;
+                    }
+                    if (conVector && vector != comprimido) {
+                        std::cout << " (ERROR: el vector da " << vector << ")";
+                    }
+                    std::cout << "\n";
+                };
+                std::cout << "\nRecorridos:\n";
+                
+                // 1) Filtro sobre dos campos codificados: ciudad y año de nacimiento
+                uint32_t codigoCiudad = 0;
+                bool ciudadExiste = almacen.ciudades().buscar(ciudad, codigoCiudad);
+                double filtroComprimido = medir("Filtro ciudad y año (comprimido)", [&] {
+                    size_t total = 0;
+                    almacen.recorrer(AlmacenComprimido::CIUDAD | AlmacenComprimido::FECHA,
+                                     [&](const AlmacenComprimido::BloqueDecodificado& b) {
+                        for (size_t j = 0; j < b.filas; ++j) {
+                            total += ciudadExiste & (b.ciudad[j] == codigoCiudad) & (b.anio[j] >= desdeAnio);
+                        }
+                    });
+                    return static_cast<double>(total);
+                });
+                double filtroPlano = !conVector ? 0 : medir("Filtro ciudad y año (vector)", [&] {
+                    size_t total = 0;
+                    for (const auto& p : plano) {
+                        // El año son los dígitos tras la última '/'
+                        int anio = std::atoi(p.fechaNacimiento.c_str() + p.fechaNacimiento.rfind('/') + 1);
+                        total += p.ciudadNacimiento == ciudad && anio >= desdeAnio;
+                    }
+                    return static_cast<double>(total);
+                });
+                comparar("   - Nacidos en " + ciudad + " desde " + std::to_string(desdeAnio),
+                         filtroComprimido, filtroPlano, true);
+                
+                // 2) Suma sobre las columnas sin comprimir (double y bit de declarante)
+                double sumaComprimido = medir("Ingresos de declarantes (comprimido)", [&] {
+                    double suma = 0;
+                    almacen.recorrer(0, [&](const AlmacenComprimido::BloqueDecodificado& b) {
+                        for (size_t j = 0; j < b.filas; ++j) {
+                            suma += b.declarante(j) ? b.ingresos[j] : 0.0;
+                        }
+                    });
+                    return suma;
+                });
+                double sumaPlano = !conVector ? 0 : medir("Ingresos de declarantes (vector)", [&] {
+                    double suma = 0;
+                    for (const auto& p : plano) {
+                        suma += p.declaranteRenta ? p.ingresosAnuales : 0.0;
+                    }
+                    return suma;
+                });
+                comparar("   - Ingresos de declarantes", sumaComprimido, sumaPlano, false);
+                
+                // 3) Reconstrucción de todos los textos de cada persona
+                double textoComprimido = medir("Reconstruir textos (comprimido)", [&] {
+                    size_t caracteres = 0;
+                    Persona p;
+                    almacen.recorrer(AlmacenComprimido::TODOS, [&](const AlmacenComprimido::BloqueDecodificado& b) {
+                        for (size_t j = 0; j < b.filas; ++j) {
+                            almacen.persona(b, j, p);
+                            caracteres += p.nombre.size() + p.apellido.size() + p.id.size()
+                                        + p.ciudadNacimiento.size() + p.fechaNacimiento.size();
+                        }
+                    });
+                    return static_cast<double>(caracteres);
+                });
+                double textoPlano = !conVector ? 0 : medir("Reconstruir textos (vector)", [&] {
+                    size_t caracteres = 0;
+                    for (const auto& p : plano) {
+                        caracteres += p.nombre.size() + p.apellido.size() + p.id.size()
+                                    + p.ciudadNacimiento.size() + p.fechaNacimiento.size();
+                    }
+                    return static_cast<double>(caracteres);
+                });
+                comparar("   - Caracteres de texto", textoComprimido, textoPlano, true);
+                
+                // Verificación: cada persona descomprimida es idéntica a la original
+                if (conVector && rechazadas == 0) {
+                    size_t distintas = 0;
+                    Persona p;
+                    almacen.recorrer(AlmacenComprimido::TODOS, [&](const AlmacenComprimido::BloqueDecodificado& b) {
+                        for (size_t j = 0; j < b.filas; ++j) {
+                            almacen.persona(b, j, p);
+                            const Persona& o = plano[b.inicio + j];
+                            distintas += p.nombre != o.nombre || p.apellido != o.apellido || p.id != o.id
+                                       || p.ciudadNacimiento != o.ciudadNacimiento
+                                       || p.fechaNacimiento != o.fechaNacimiento
+                                       || p.ingresosAnuales != o.ingresosAnuales || p.patrimonio != o.patrimonio
+                                       || p.deudas != o.deudas || p.declaranteRenta != o.declaranteRenta;
+                        }
+                    });
+                    std::cout << "Personas distintas tras descomprimir: " << distintas << "\n";
+                }
+                break;
+            }
+                
+            case 10:
                 std::cout << "Saliendo...\n";
                 break;
                 
@@ -147,13 +528,13 @@ int main() {
         }
         
         // Mostrar estadísticas para las operaciones principales
-        if (opcion >= 0 && opcion <= 3) {
+        if ((opcion >= 0 && opcion <= 3) || opcion == 6 || opcion == 8 || opcion == 9) {
             double tiempo = monitor.detener_tiempo();
             long memoria = monitor.obtener_memoria() - memoria_inicio;
             monitor.mostrar_estadistica("Opción " + std::to_string(opcion), tiempo, memoria);
         }
         
-    } while(opcion != 6);
+    } while(opcion != 10);
     
     return 0;
 }
\ No newline at end of file
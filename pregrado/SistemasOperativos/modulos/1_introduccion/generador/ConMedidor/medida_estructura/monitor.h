@@ -19,10 +19,11 @@ public:
         inicio = std::chrono::high_resolution_clock::now();
     }
     
-    // Detiene la medición de tiempo y devuelve milisegundos
+    // Detiene la medición de tiempo y devuelve milisegundos (con fracción: los núcleos
+    // de agregación tardan pocos ms y se necesita precisión para calcular GB/s)
     double detener_tiempo() {
         auto fin = std::chrono::high_resolution_clock::now();
-        return std::chrono::duration_cast<std::chrono::milliseconds>(fin - inicio).count();
+        return std::chrono::duration<double, std::milli>(fin - inicio).count();
     }
     
     // Obtiene el consumo de memoria actual en KB usando /proc/self/statm
@@ -52,11 +53,33 @@ public:
     
     // Registra estadísticas para una operación
     void registrar(const std::string& operacion, double tiempo, long memoria) {
-        registros.push_back({operacion, tiempo, memoria});
+        registros.push_back({operacion, tiempo, memoria, 0.0, 0.0});
         total_tiempo += tiempo;
         max_memoria = std::max(max_memoria, memoria);
     }
     
+    // Registra una operación que recorre 'bytes' de memoria y muestra el ancho de banda logrado
+    void registrar_recorrido(const std::string& operacion, double tiempo, long memoria,
+                             unsigned long long bytes) {
+        double gb_s = tiempo > 0 ? (bytes / 1e9) / (tiempo / 1000.0) : 0.0;
+        registros.push_back({operacion, tiempo, memoria, gb_s, 0.0});
+        total_tiempo += tiempo;
+        max_memoria = std::max(max_memoria, memoria);
+        std::cout << "[RECORRIDO] " << operacion << " - " << tiempo << " ms, "
+                  << gb_s << " GB/s\n";
+    }
+    
+    // Registra un escaneo de 'filas' filas y muestra el rendimiento en filas por segundo
+    void registrar_filas(const std::string& operacion, double tiempo, long memoria,
+                         unsigned long long filas) {
+        double filas_s = tiempo > 0 ? filas / (tiempo / 1000.0) : 0.0;
+        registros.push_back({operacion, tiempo, memoria, 0.0, filas_s});
+        total_tiempo += tiempo;
+        max_memoria = std::max(max_memoria, memoria);
+        std::cout << "[RECORRIDO] " << operacion << " - " << tiempo << " ms, "
+                  << filas_s / 1e6 << " M filas/s\n";
+    }
+    
     // Muestra estadísticas de una operación
     void mostrar_estadistica(const std::string& operacion, double tiempo, long memoria) {
         std::cout << "\n[ESTADÍSTICAS] " << operacion << " - "
@@ -70,6 +93,12 @@ public:
         for (const auto& reg : registros) {
             std::cout << "\n" << reg.operacion << ": "
                       << reg.tiempo << " ms, " << reg.memoria << " KB";
+            if (reg.gb_s > 0) {
+                std::cout << ", " << reg.gb_s << " GB/s";
+            }
+            if (reg.filas_s > 0) {
+                std::cout << ", " << reg.filas_s / 1e6 << " M filas/s";
+            }
         }
         std::cout << "\nTotal tiempo: " << total_tiempo << " ms";
         std::cout << "\nMemoria máxima: " << max_memoria << " KB\n";
@@ -78,9 +107,10 @@ public:
     // Exporta las estadísticas a un archivo CSV
     void exportar_csv(const std::string& nombre_archivo = "estadisticas.csv") {
         std::ofstream archivo(nombre_archivo);
-        archivo << "Operacion,Tiempo(ms),Memoria(KB)\n";
+        archivo << "Operacion,Tiempo(ms),Memoria(KB),GB/s,Filas/s\n";
         for (const auto& reg : registros) {
-            archivo << reg.operacion << "," << reg.tiempo << "," << reg.memoria << "\n";
+            archivo << reg.operacion << "," << reg.tiempo << "," << reg.memoria << ","
+                    << reg.gb_s << "," << reg.filas_s << "\n";
         }
         archivo.close();
         std::cout << "Estadísticas exportadas a " << nombre_archivo << "\n";
@@ -91,6 +121,8 @@ private:
         std::string operacion;
         double tiempo;
         long memoria;
+        double gb_s;    // Ancho de banda de lectura (0 si no aplica)
+        double filas_s; // Filas escaneadas por segundo (0 si no aplica)
     };
     
     std::chrono::high_resolution_clock::time_point inicio;
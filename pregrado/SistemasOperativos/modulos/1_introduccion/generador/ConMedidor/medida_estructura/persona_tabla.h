@@ -0,0 +1,107 @@
+#ifndef PERSONA_TABLA_H
+#define PERSONA_TABLA_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <iomanip>
+#include "persona.h"
+
+// Tabla columnar (struct-of-arrays) de personas.
+// Cada atributo vive en su propio vector contiguo: un recorrido sobre
+// ingresosAnuales solo lee 8 bytes por registro en lugar de la Persona completa.
+struct PersonaTable {
+    // --- Columnas de texto ---
+    std::vector<std::string> nombre;
+    std::vector<std::string> apellido;
+    std::vector<std::string> id;
+    std::vector<std::string> ciudadNacimiento;
+    std::vector<std::string> fechaNacimiento;
+
+    // --- Columnas numéricas contiguas ---
+    std::vector<double> ingresosAnuales;
+    std::vector<double> patrimonio;
+    std::vector<double> deudas;
+
+    // --- Bitmap empaquetado: bit i = declaranteRenta de la fila i ---
+    std::vector<uint64_t> declaranteRenta;
+
+    // --- Métodos de acceso ---
+    size_t size() const { return id.size(); }
+    bool empty() const { return id.empty(); }
+    void reserve(size_t n);               // Reserva capacidad en todas las columnas
+    void agregar(Persona p);              // Añade una fila moviendo los strings
+    bool esDeclarante(size_t fila) const; // Lee un bit del bitmap
+    Persona fila(size_t i) const;         // Reconstruye la Persona de la fila i
+
+    // --- Métodos de visualización ---
+    void mostrar(size_t i) const;         // Muestra todos los detalles de la fila i
+    void mostrarResumen(size_t i) const;  // Muestra versión compacta de la fila i
+};
+
+inline void PersonaTable::reserve(size_t n) {
+    nombre.reserve(n);
+    apellido.reserve(n);
+    id.reserve(n);
+    ciudadNacimiento.reserve(n);
+    fechaNacimiento.reserve(n);
+    ingresosAnuales.reserve(n);
+    patrimonio.reserve(n);
+    deudas.reserve(n);
+    declaranteRenta.reserve((n + 63) / 64);
+}
+
+inline void PersonaTable::agregar(Persona p) {
+    size_t i = size();
+
+    nombre.push_back(std::move(p.nombre));
+    apellido.push_back(std::move(p.apellido));
+    id.push_back(std::move(p.id));
+    ciudadNacimiento.push_back(std::move(p.ciudadNacimiento));
+    fechaNacimiento.push_back(std::move(p.fechaNacimiento));
+
+    ingresosAnuales.push_back(p.ingresosAnuales);
+    patrimonio.push_back(p.patrimonio);
+    deudas.push_back(p.deudas);
+
+    // Abre una palabra nueva cada 64 filas
+    if (i % 64 == 0) {
+        declaranteRenta.push_back(0);
+    }
+    if (p.declaranteRenta) {
+        declaranteRenta[i / 64] |= uint64_t(1) << (i % 64);
+    }
+}
+
+inline bool PersonaTable::esDeclarante(size_t i) const {
+    return (declaranteRenta[i / 64] >> (i % 64)) & 1;
+}
+
+inline Persona PersonaTable::fila(size_t i) const {
+    Persona p;
+    p.nombre = nombre[i];
+    p.apellido = apellido[i];
+    p.id = id[i];
+    p.ciudadNacimiento = ciudadNacimiento[i];
+    p.fechaNacimiento = fechaNacimiento[i];
+    p.ingresosAnuales = ingresosAnuales[i];
+    p.patrimonio = patrimonio[i];
+    p.deudas = deudas[i];
+    p.declaranteRenta = esDeclarante(i);
+    return p;
+}
+
+inline void PersonaTable::mostrar(size_t i) const {
+    // El detalle es de un solo registro: reconstruir la Persona es barato
+    fila(i).mostrar();
+}
+
+inline void PersonaTable::mostrarResumen(size_t i) const {
+    // Lee las columnas directamente, sin copiar strings
+    std::cout << "[" << id[i] << "] " << nombre[i] << " " << apellido[i]
+              << " | " << ciudadNacimiento[i]
+              << " | $" << std::fixed << std::setprecision(2) << ingresosAnuales[i];
+}
+
+#endif // PERSONA_TABLA_H
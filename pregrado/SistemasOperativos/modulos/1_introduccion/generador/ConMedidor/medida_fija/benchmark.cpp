@@ -0,0 +1,123 @@
+#include "benchmark.h"
+#include "coleccion_fija.h"
+#include "generador.h"
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace {
+
+// Bytes que ocupa una columna de strings: los objetos más el texto que no cabe en línea (SSO)
+size_t bytesColumna(const std::vector<std::string>& columna) {
+    size_t total = columna.capacity() * sizeof(std::string);
+    for (const auto& texto : columna) {
+        if (texto.capacity() > 15) {
+            total += texto.capacity() + 1;
+        }
+    }
+    return total;
+}
+
+// Bytes totales de la tabla columnar
+size_t bytesTabla(const PersonaTable& t) {
+    return bytesColumna(t.nombre) + bytesColumna(t.apellido) + bytesColumna(t.id)
+         + bytesColumna(t.ciudadNacimiento) + bytesColumna(t.fechaNacimiento)
+         + (t.ingresosAnuales.capacity() + t.patrimonio.capacity() + t.deudas.capacity()) * sizeof(double)
+         + t.declaranteRenta.capacity() * sizeof(uint64_t);
+}
+
+// Imprime una fila de la comparación y la registra en el monitor
+void reportar(Monitor& monitor, const std::string& operacion, double msFija, double msTabla) {
+    std::cout << std::left << std::setw(22) << operacion << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << msFija << std::setw(14) << msTabla
+              << std::setw(14) << (msFija > 0 ? msTabla / msFija : 0) << "x\n";
+    monitor.registrar(operacion + " (fija)", msFija, 0);
+    monitor.registrar(operacion + " (columnar)", msTabla, 0);
+}
+
+} // namespace
+
+void compararDisposiciones(int n, unsigned semilla, Monitor& monitor) {
+    const std::string ciudadBuscada = "Medellín";
+
+    // --- Generar ---
+    monitor.iniciar_tiempo();
+    std::vector<PersonaFija> fija = generarColeccion(n, semilla);
+    double genFija = monitor.detener_tiempo();
+
+    monitor.iniciar_tiempo();
+    PersonaTable tabla = generarTabla(n, semilla);
+    double genTabla = monitor.detener_tiempo();
+
+    // --- Copiar ---
+    monitor.iniciar_tiempo();
+    std::vector<PersonaFija> copiaFija = clonarColeccion(fija);
+    double copiaMsFija = monitor.detener_tiempo();
+
+    monitor.iniciar_tiempo();
+    PersonaTable copiaTabla = tabla;
+    double copiaMsTabla = monitor.detener_tiempo();
+
+    // --- Recorrer ingresos de declarantes ---
+    monitor.iniciar_tiempo();
+    double sumaFija = 0;
+    for (const auto& p : fija) {
+        if (p.declaranteRenta) {
+            sumaFija += p.ingresosAnuales;
+        }
+    }
+    double numFija = monitor.detener_tiempo();
+
+    monitor.iniciar_tiempo();
+    double sumaTabla = 0;
+    for (size_t i = 0; i < tabla.size(); ++i) {
+        if (tabla.esDeclarante(i)) {
+            sumaTabla += tabla.ingresosAnuales[i];
+        }
+    }
+    double numTabla = monitor.detener_tiempo();
+
+    // --- Recorrer ciudad ---
+    monitor.iniciar_tiempo();
+    size_t cuentaFija = 0;
+    for (const auto& p : fija) {
+        cuentaFija += (p.ciudadNacimiento == ciudadBuscada);
+    }
+    double textoFija = monitor.detener_tiempo();
+
+    monitor.iniciar_tiempo();
+    size_t cuentaTabla = 0;
+    for (const auto& ciudad : tabla.ciudadNacimiento) {
+        cuentaTabla += (ciudad == ciudadBuscada);
+    }
+    double textoTabla = monitor.detener_tiempo();
+
+    // --- Reporte ---
+    size_t memFija = fija.capacity() * sizeof(PersonaFija);
+    size_t memTabla = bytesTabla(tabla);
+
+    std::cout << "\n=== FIJA vs COLUMNAR (" << n << " personas, semilla " << semilla << ") ===\n";
+    std::cout << std::left << std::setw(23) << "Operación" << std::right // 'ó' ocupa 2 bytes
+              << std::setw(12) << "Fija (ms)" << std::setw(14) << "Columnar (ms)"
+              << "  Columnar/Fija\n";
+    reportar(monitor, "Generar", genFija, genTabla);
+    reportar(monitor, "Copiar", copiaMsFija, copiaMsTabla);
+    reportar(monitor, "Recorrer ingresos", numFija, numTabla);
+    reportar(monitor, "Recorrer ciudad", textoFija, textoTabla);
+
+    std::cout << "\nMemoria: fija " << memFija / 1024 << " KB (" << sizeof(PersonaFija)
+              << " B/registro), columnar " << memTabla / 1024 << " KB ("
+              << (n > 0 ? memTabla / n : 0) << " B/registro)\n";
+    if (copiaMsFija > 0) {
+        std::cout << "Copia fija: " << std::setprecision(1)
+                  << (memFija / (1024.0 * 1024.0)) / (copiaMsFija / 1000.0) << " MB/s\n";
+    }
+
+    // Los resultados deben coincidir: mismos datos, distinta disposición
+    bool coinciden = sumaFija == sumaTabla && cuentaFija == cuentaTabla
+                  && copiaFija.size() == copiaTabla.size();
+    std::cout << "Declarantes: $" << std::setprecision(2) << sumaFija
+              << " | " << ciudadBuscada << ": " << cuentaFija
+              << (coinciden ? " | Resultados iguales en ambas disposiciones\n"
+                            : " | ERROR: las disposiciones no coinciden\n");
+}
@@ -0,0 +1,15 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "monitor.h"
+
+// Compara PersonaFija (registro trivialmente copiable) contra la tabla columnar
+// de medida_estructura (std::string por campo) con los mismos n registros:
+//   - Generar: construir la colección completa
+//   - Copiar: clonar la colección (memcpy frente a copiar cada std::string)
+//   - Recorrer ingresos: sumar ingresos de los declarantes (campo numérico)
+//   - Recorrer ciudad: contar una ciudad (campo de texto)
+// Imprime tiempos, memoria ocupada por cada disposición y registra todo en el monitor.
+void compararDisposiciones(int n, unsigned semilla, Monitor& monitor);
+
+#endif // BENCHMARK_H
@@ -0,0 +1,120 @@
+#ifndef COLECCION_FIJA_H
+#define COLECCION_FIJA_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "persona_fija.h"
+
+// Operaciones de bloque sobre colecciones de PersonaFija.
+// Como PersonaFija es trivialmente copiable, la colección completa es un solo arreglo
+// de bytes: clonar es un memcpy y persistir es un write/read (sin serializar campo a campo).
+
+// Cabecera del archivo binario: firma, tamaño de registro (detecta cambios de
+// disposición) y número de registros. Los registros siguen en crudo.
+struct CabeceraFija {
+    char firma[8];          // "PERFIJA1"
+    uint64_t tamRegistro;   // sizeof(PersonaFija) al guardar
+    uint64_t numRegistros;  // Registros que siguen a la cabecera
+};
+
+const char FIRMA_FIJA[8] = {'P', 'E', 'R', 'F', 'I', 'J', 'A', '1'};
+
+// Copia la colección con un único memcpy
+inline std::vector<PersonaFija> clonarColeccion(const std::vector<PersonaFija>& origen) {
+    std::vector<PersonaFija> copia(origen.size());
+    if (!origen.empty()) {
+        std::memcpy(copia.data(), origen.data(), origen.size() * sizeof(PersonaFija));
+    }
+    return copia;
+}
+
+// Escribe 'total' bytes reintentando escrituras parciales
+inline bool escribirBytes(int fd, const void* datos, size_t total) {
+    const char* p = static_cast<const char*>(datos);
+    while (total > 0) {
+        ssize_t escritos = write(fd, p, total);
+        if (escritos <= 0) {
+            return false;
+        }
+        p += escritos;
+        total -= static_cast<size_t>(escritos);
+    }
+    return true;
+}
+
+// Lee exactamente 'total' bytes reintentando lecturas parciales
+inline bool leerBytes(int fd, void* datos, size_t total) {
+    char* p = static_cast<char*>(datos);
+    while (total > 0) {
+        ssize_t leidos = read(fd, p, total);
+        if (leidos <= 0) {
+            return false;
+        }
+        p += leidos;
+        total -= static_cast<size_t>(leidos);
+    }
+    return true;
+}
+
+// Guarda la colección: cabecera + arreglo de registros en una sola escritura.
+// Retorna los bytes escritos, o 0 si hubo un error.
+inline unsigned long long guardarColeccion(const std::vector<PersonaFija>& personas, const std::string& ruta) {
+    int fd = open(ruta.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        perror(("Error al abrir " + ruta).c_str());
+        return 0;
+    }
+    CabeceraFija cabecera;
+    std::memcpy(cabecera.firma, FIRMA_FIJA, sizeof(cabecera.firma));
+    cabecera.tamRegistro = sizeof(PersonaFija);
+    cabecera.numRegistros = personas.size();
+
+    size_t bytesDatos = personas.size() * sizeof(PersonaFija);
+    bool ok = escribirBytes(fd, &cabecera, sizeof(cabecera))
+           && escribirBytes(fd, personas.data(), bytesDatos);
+    if (close(fd) != 0 || !ok) {
+        std::cerr << "Error al escribir " << ruta << "\n";
+        return 0;
+    }
+    return sizeof(cabecera) + bytesDatos;
+}
+
+// Carga una colección guardada con guardarColeccion: valida la cabecera y
+// lee todos los registros directamente en el vector con una sola lectura.
+// Retorna false si el archivo no existe, no es válido o su tamaño no coincide con la cabecera.
+inline bool cargarColeccion(const std::string& ruta, std::vector<PersonaFija>& personas) {
+    int fd = open(ruta.c_str(), O_RDONLY);
+    if (fd < 0) {
+        perror(("Error al abrir " + ruta).c_str());
+        return false;
+    }
+    CabeceraFija cabecera;
+    struct stat info;
+    if (fstat(fd, &info) != 0
+        || !leerBytes(fd, &cabecera, sizeof(cabecera))
+        || std::memcmp(cabecera.firma, FIRMA_FIJA, sizeof(cabecera.firma)) != 0
+        || cabecera.tamRegistro != sizeof(PersonaFija)
+        || cabecera.numRegistros != (static_cast<uint64_t>(info.st_size) - sizeof(cabecera)) / sizeof(PersonaFija)) {
+        std::cerr << "Archivo inválido o de otra versión: " << ruta << "\n";
+        close(fd);
+        return false;
+    }
+
+    std::vector<PersonaFija> leidas(cabecera.numRegistros);
+    bool ok = leerBytes(fd, leidas.data(), leidas.size() * sizeof(PersonaFija));
+    close(fd);
+    if (!ok) {
+        std::cerr << "Archivo truncado: " << ruta << "\n";
+        return false;
+    }
+    personas = std::move(leidas);
+    return true;
+}
+
+#endif // COLECCION_FIJA_H
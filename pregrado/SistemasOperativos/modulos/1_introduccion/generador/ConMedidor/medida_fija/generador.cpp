@@ -0,0 +1,146 @@
+#include "generador.h"
+#include <charconv>  // std::to_chars
+#include <cstring>   // std::memset
+#include <random>    // Generadores aleatorios modernos
+
+// --- Bases de datos para generación realista ---
+
+// Nombres femeninos comunes en Colombia
+const std::vector<std::string> nombresFemeninos = {
+    "María", "Luisa", "Carmen", "Ana", "Sofía", "Isabel", "Laura", "Andrea", "Paula", "Valentina",
+    "Camila", "Daniela", "Carolina", "Fernanda", "Gabriela", "Patricia", "Claudia", "Diana", "Lucía", "Ximena"
+};
+
+// Nombres masculinos comunes en Colombia
+const std::vector<std::string> nombresMasculinos = {
+    "Juan", "Carlos", "José", "James", "Andrés", "Miguel", "Luis", "Pedro", "Alejandro", "Ricardo",
+    "Felipe", "David", "Jorge", "Santiago", "Daniel", "Fernando", "Diego", "Rafael", "Martín", "Óscar",
+    "Edison", "Nestor", "Gertridis"
+};
+
+// Apellidos comunes en Colombia
+const std::vector<std::string> apellidos = {
+    "Gómez", "Rodríguez", "Martínez", "López", "García", "Pérez", "González", "Sánchez", "Ramírez", "Torres",
+    "Díaz", "Vargas", "Castro", "Ruiz", "Álvarez", "Romero", "Suárez", "Rojas", "Moreno", "Muñoz", "Valencia",
+};
+
+// Principales ciudades colombianas
+const std::vector<std::string> ciudadesColombia = {
+    "Bogotá", "Medellín", "Cali", "Barranquilla", "Cartagena", "Bucaramanga", "Pereira", "Santa Marta", "Cúcuta", "Ibagué",
+    "Manizales", "Pasto", "Neiva", "Villavicencio", "Armenia", "Sincelejo", "Valledupar", "Montería", "Popayán", "Tunja"
+};
+
+namespace {
+
+// Valores sorteados para un registro, antes de elegir la disposición en memoria
+struct Sorteo {
+    const std::string* nombre;
+    const std::string* apellido1;
+    const std::string* apellido2;
+    const std::string* ciudad;
+    long id;
+    int dia, mes, anio;
+    double ingresosAnuales, patrimonio, deudas;
+    bool declaranteRenta;
+};
+
+// Sortea un registro con los mismos rangos que los demás generadores
+Sorteo sortear(std::mt19937& motor, long id) {
+    Sorteo s;
+    bool esHombre = motor() % 2;
+    s.nombre = esHombre ? &nombresMasculinos[motor() % nombresMasculinos.size()]
+                        : &nombresFemeninos[motor() % nombresFemeninos.size()];
+    s.apellido1 = &apellidos[motor() % apellidos.size()];
+    s.apellido2 = &apellidos[motor() % apellidos.size()];
+    s.id = id;
+    s.ciudad = &ciudadesColombia[motor() % ciudadesColombia.size()];
+    s.dia = 1 + motor() % 28;
+    s.mes = 1 + motor() % 12;
+    s.anio = 1960 + motor() % 50;
+
+    // Ingresos entre 10M y 500M, patrimonio hasta 2.000M, deudas hasta el 70% del patrimonio
+    std::uniform_real_distribution<double> ingresos(10000000, 500000000);
+    std::uniform_real_distribution<double> patrimonio(0, 2000000000);
+    s.ingresosAnuales = ingresos(motor);
+    s.patrimonio = patrimonio(motor);
+    s.deudas = std::uniform_real_distribution<double>(0, s.patrimonio * 0.7)(motor);
+    s.declaranteRenta = (s.ingresosAnuales > 50000000) && (motor() % 100 > 30);
+    return s;
+}
+
+const long ID_INICIAL = 1000000000;
+
+} // namespace
+
+std::vector<PersonaFija> generarColeccion(int n, unsigned semilla) {
+    std::mt19937 motor(semilla);
+    std::vector<PersonaFija> personas(n > 0 ? n : 0);
+
+    for (int i = 0; i < n; ++i) {
+        Sorteo s = sortear(motor, ID_INICIAL + i);
+        PersonaFija& p = personas[i];
+        std::memset(&p, 0, sizeof(p)); // Relleno en cero: bytes deterministas al persistir
+
+        // Los textos se copian directo al registro, sin strings temporales
+        p.nombre.asignar(*s.nombre);
+        char apellido[64];
+        size_t largo = s.apellido1->size();
+        std::memcpy(apellido, s.apellido1->data(), largo);
+        apellido[largo++] = ' ';
+        std::memcpy(apellido + largo, s.apellido2->data(), s.apellido2->size());
+        p.apellido.asignar(apellido, largo + s.apellido2->size());
+
+        char numero[24];
+        p.id.asignar(numero, std::to_chars(numero, numero + sizeof(numero), s.id).ptr - numero);
+        p.ciudadNacimiento.asignar(*s.ciudad);
+
+        char fecha[24];
+        char* fin = std::to_chars(fecha, fecha + 4, s.dia).ptr;
+        *fin++ = '/';
+        fin = std::to_chars(fin, fin + 4, s.mes).ptr;
+        *fin++ = '/';
+        fin = std::to_chars(fin, fin + 8, s.anio).ptr;
+        p.fechaNacimiento.asignar(fecha, fin - fecha);
+
+        p.ingresosAnuales = s.ingresosAnuales;
+        p.patrimonio = s.patrimonio;
+        p.deudas = s.deudas;
+        p.declaranteRenta = s.declaranteRenta;
+    }
+    return personas;
+}
+
+PersonaTable generarTabla(int n, unsigned semilla) {
+    std::mt19937 motor(semilla);
+    PersonaTable tabla;
+    tabla.reserve(n > 0 ? n : 0);
+
+    for (int i = 0; i < n; ++i) {
+        Sorteo s = sortear(motor, ID_INICIAL + i);
+
+        // Igual que el generador de medida_estructura: un std::string por campo
+        Persona p;
+        p.nombre = *s.nombre;
+        p.apellido = *s.apellido1 + " " + *s.apellido2;
+        p.id = std::to_string(s.id);
+        p.ciudadNacimiento = *s.ciudad;
+        p.fechaNacimiento = std::to_string(s.dia) + "/" + std::to_string(s.mes) + "/" + std::to_string(s.anio);
+        p.ingresosAnuales = s.ingresosAnuales;
+        p.patrimonio = s.patrimonio;
+        p.deudas = s.deudas;
+        p.declaranteRenta = s.declaranteRenta;
+        tabla.agregar(std::move(p));
+    }
+    return tabla;
+}
+
+long buscarPorID(const std::vector<PersonaFija>& personas, const std::string& id) {
+    // Búsqueda lineal comparando el texto en línea (sin construir strings)
+    const size_t tam = personas.size();
+    for (size_t i = 0; i < tam; ++i) {
+        if (personas[i].id == id) {
+            return static_cast<long>(i);
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,26 @@
+#ifndef GENERADOR_H
+#define GENERADOR_H
+
+#include "persona_fija.h"
+#include "../medida_estructura/persona_tabla.h"
+#include <string>
+#include <vector>
+
+// Vocabulario fijo de ciudades
+extern const std::vector<std::string> ciudadesColombia;
+
+// --- Funciones para generación de datos aleatorios ---
+// Ambas versiones consumen la misma secuencia aleatoria: con la misma semilla
+// producen exactamente los mismos datos, solo cambia la disposición en memoria.
+
+// Genera colección de n personas de tamaño fijo (textos en línea, sin memoria dinámica)
+std::vector<PersonaFija> generarColeccion(int n, unsigned semilla);
+
+// Genera los mismos n registros en la tabla columnar de medida_estructura (std::string por campo)
+PersonaTable generarTabla(int n, unsigned semilla);
+
+// Busca persona por ID
+// Retorna la fila si la encuentra, -1 si no
+long buscarPorID(const std::vector<PersonaFija>& personas, const std::string& id);
+
+#endif // GENERADOR_H
@@ -0,0 +1,220 @@
+#include <iostream>
+#include <vector>
+#include <limits> // Para manejo de límites de entrada
+#include <memory> // Para std::unique_ptr y std::make_unique
+#include <ctime>
+#include "persona_fija.h"
+#include "coleccion_fija.h"
+#include "generador.h"
+#include "benchmark.h"
+#include "monitor.h"
+
+void mostrarMenu() {
+    std::cout << "\n\n=== MENÚ PRINCIPAL ===";
+    std::cout << "\n0. Crear nuevo conjunto de datos";
+    std::cout << "\n1. Mostrar resumen de todas las personas";
+    std::cout << "\n2. Mostrar detalle completo por índice";
+    std::cout << "\n3. Buscar persona por ID";
+    std::cout << "\n4. Mostrar estadísticas de rendimiento";
+    std::cout << "\n5. Exportar estadísticas a CSV";
+    std::cout << "\n6. Comparar con la tabla columnar (medida_estructura)";
+    std::cout << "\n7. Guardar colección binaria (una sola escritura)";
+    std::cout << "\n8. Cargar colección binaria (una sola lectura)";
+    std::cout << "\n9. Salir";
+    std::cout << "\nSeleccione una opción: ";
+}
+
+int main() {
+    // Colección de registros de tamaño fijo: un único bloque contiguo de memoria
+    std::unique_ptr<std::vector<PersonaFija>> personas = nullptr;
+    Monitor monitor;
+
+    int opcion;
+    do {
+        mostrarMenu();
+        std::cin >> opcion;
+
+        size_t tam = 0;
+        int indice;
+        std::string idBusqueda;
+        std::string ruta;
+
+        // Iniciar medición de tiempo y memoria para esta operación
+        monitor.iniciar_tiempo();
+        long memoria_inicio = monitor.obtener_memoria();
+
+        switch(opcion) {
+            case 0: {
+                int n;
+                std::cout << "\nIngrese el número de personas a generar: ";
+                std::cin >> n;
+
+                if (n <= 0) {
+                    std::cout << "Error: Debe generar al menos 1 persona\n";
+                    break;
+                }
+
+                // Generar el nuevo conjunto de datos (semilla distinta en cada ejecución)
+                monitor.iniciar_tiempo();
+                personas = std::make_unique<std::vector<PersonaFija>>(
+                    generarColeccion(n, static_cast<unsigned>(time(nullptr))));
+                tam = personas->size();
+
+                double tiempo_gen = monitor.detener_tiempo();
+                long memoria_gen = monitor.obtener_memoria() - memoria_inicio;
+
+                std::cout << "Generadas " << tam << " personas en "
+                          << tiempo_gen << " ms, Memoria: " << memoria_gen << " KB\n";
+                std::cout << "Tamaño de registro: " << sizeof(PersonaFija) << " bytes, colección: "
+                          << tam * sizeof(PersonaFija) / 1024 << " KB contiguos\n";
+
+                monitor.registrar("Crear datos", tiempo_gen, memoria_gen);
+                break;
+            }
+
+            case 1: {
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+
+                tam = personas->size();
+                std::cout << "\n=== RESUMEN DE PERSONAS (" << tam << ") ===\n";
+                for(size_t i = 0; i < tam; ++i) {
+                    std::cout << i << ". ";
+                    (*personas)[i].mostrarResumen();
+                    std::cout << "\n";
+                }
+
+                double tiempo_mostrar = monitor.detener_tiempo();
+                long memoria_mostrar = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Mostrar resumen", tiempo_mostrar, memoria_mostrar);
+                break;
+            }
+
+            case 2: {
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+
+                tam = personas->size();
+                std::cout << "\nIngrese el índice (0-" << tam-1 << "): ";
+                if(std::cin >> indice) {
+                    if(indice >= 0 && static_cast<size_t>(indice) < tam) {
+                        (*personas)[indice].mostrar();
+                    } else {
+                        std::cout << "Índice fuera de rango!\n";
+                    }
+                } else {
+                    std::cout << "Entrada inválida!\n";
+                    std::cin.clear();
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                }
+
+                double tiempo_detalle = monitor.detener_tiempo();
+                long memoria_detalle = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Mostrar detalle", tiempo_detalle, memoria_detalle);
+                break;
+            }
+
+            case 3: {
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+
+                std::cout << "\nIngrese el ID a buscar: ";
+                std::cin >> idBusqueda;
+
+                long fila = buscarPorID(*personas, idBusqueda);
+                if(fila >= 0) {
+                    (*personas)[fila].mostrar();
+                } else {
+                    std::cout << "No se encontró persona con ID " << idBusqueda << "\n";
+                }
+
+                double tiempo_busqueda = monitor.detener_tiempo();
+                long memoria_busqueda = monitor.obtener_memoria() - memoria_inicio;
+                monitor.registrar("Buscar por ID", tiempo_busqueda, memoria_busqueda);
+                break;
+            }
+
+            case 4:
+                monitor.mostrar_resumen();
+                break;
+
+            case 5:
+                monitor.exportar_csv();
+                break;
+
+            case 6: {
+                int n;
+                unsigned semilla;
+                std::cout << "\nNúmero de personas para la comparación: ";
+                std::cin >> n;
+                std::cout << "Semilla: ";
+                std::cin >> semilla;
+
+                if (n <= 0) {
+                    std::cout << "Error: Debe comparar al menos 1 persona\n";
+                    break;
+                }
+                compararDisposiciones(n, semilla, monitor);
+                break;
+            }
+
+            case 7: {
+                if (!personas || personas->empty()) {
+                    std::cout << "\nNo hay datos disponibles. Use opción 0 primero.\n";
+                    break;
+                }
+
+                std::cout << "\nArchivo de salida: ";
+                std::cin >> ruta;
+
+                unsigned long long bytes = guardarColeccion(*personas, ruta);
+                double tiempo_guardar = monitor.detener_tiempo();
+                if (bytes > 0) {
+                    std::cout << "Guardadas " << personas->size() << " personas (" << bytes / 1024
+                              << " KB) en " << tiempo_guardar << " ms\n";
+                }
+                monitor.registrar("Guardar binario", tiempo_guardar, monitor.obtener_memoria() - memoria_inicio);
+                break;
+            }
+
+            case 8: {
+                std::cout << "\nArchivo de entrada: ";
+                std::cin >> ruta;
+
+                std::vector<PersonaFija> cargadas;
+                if (cargarColeccion(ruta, cargadas)) {
+                    personas = std::make_unique<std::vector<PersonaFija>>(std::move(cargadas));
+                    double tiempo_cargar = monitor.detener_tiempo();
+                    std::cout << "Cargadas " << personas->size() << " personas en "
+                              << tiempo_cargar << " ms\n";
+                    monitor.registrar("Cargar binario", tiempo_cargar, monitor.obtener_memoria() - memoria_inicio);
+                }
+                break;
+            }
+
+            case 9:
+                std::cout << "Saliendo...\n";
+                break;
+
+            default:
+                std::cout << "Opción inválida!\n";
+        }
+
+        // Mostrar estadísticas para las operaciones principales
+        // (la comparación de la opción 6 mide y reporta cada operación por separado)
+        if ((opcion >= 0 && opcion <= 3) || opcion == 7 || opcion == 8) {
+            double tiempo = monitor.detener_tiempo();
+            long memoria = monitor.obtener_memoria() - memoria_inicio;
+            monitor.mostrar_estadistica("Opción " + std::to_string(opcion), tiempo, memoria);
+        }
+
+    } while(opcion != 9);
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+#ifndef PERSONA_FIJA_H
+#define PERSONA_FIJA_H
+
+#include <iostream>
+#include <iomanip>
+#include <type_traits>
+#include "texto_fijo.h"
+
+// Persona con todos sus textos en línea (FixedString), sin punteros ni memoria dinámica.
+// Es trivialmente copiable y de disposición estándar: un vector de PersonaFija es un
+// único bloque de bytes que se clona, persiste o comparte con un solo memcpy/write.
+// Las capacidades cubren el vocabulario del generador (en bytes UTF-8):
+// nombre <= 9, dos apellidos <= 21, cédula de 10-11 dígitos, ciudad <= 13, fecha DD/MM/AAAA.
+struct PersonaFija {
+    // Datos básicos de identificación (80 bytes)
+    FixedString<15> nombre;           // Nombre de pila
+    FixedString<23> apellido;         // Apellidos
+    FixedString<11> id;               // Identificador único (cédula)
+    FixedString<15> ciudadNacimiento; // Ciudad de nacimiento en Colombia
+    FixedString<11> fechaNacimiento;  // Fecha en formato DD/MM/AAAA
+
+    // Datos fiscales y económicos
+    double ingresosAnuales;           // Ingresos anuales en pesos colombianos
+    double patrimonio;                // Valor total de bienes y activos
+    double deudas;                    // Deudas pendientes
+    bool declaranteRenta;             // Si está obligado a declarar renta
+
+    // --- Métodos de visualización ---
+    void mostrar() const;             // Muestra todos los detalles completos
+    void mostrarResumen() const;      // Muestra versión compacta para listados
+};
+
+static_assert(std::is_trivially_copyable<PersonaFija>::value, "PersonaFija debe copiarse con memcpy");
+static_assert(std::is_standard_layout<PersonaFija>::value, "PersonaFija debe tener disposición estándar");
+static_assert(sizeof(PersonaFija) == 112, "Cambio inesperado en el tamaño de PersonaFija");
+
+inline void PersonaFija::mostrar() const {
+    std::cout << "-------------------------------------\n";
+    std::cout << "[" << id << "] Nombre: " << nombre << " " << apellido << "\n";
+    std::cout << "   - Ciudad de nacimiento: " << ciudadNacimiento << "\n";
+    std::cout << "   - Fecha de nacimiento: " << fechaNacimiento << "\n\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "   - Ingresos anuales: $" << ingresosAnuales << "\n";
+    std::cout << "   - Patrimonio: $" << patrimonio << "\n";
+    std::cout << "   - Deudas: $" << deudas << "\n";
+    std::cout << "   - Declarante de renta: " << (declaranteRenta ? "Sí" : "No") << "\n";
+}
+
+inline void PersonaFija::mostrarResumen() const {
+    std::cout << "[" << id << "] " << nombre << " " << apellido
+              << " | " << ciudadNacimiento
+              << " | $" << std::fixed << std::setprecision(2) << ingresosAnuales;
+}
+
+#endif // PERSONA_FIJA_H
@@ -0,0 +1,55 @@
+#ifndef TEXTO_FIJO_H
+#define TEXTO_FIJO_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Texto de capacidad fija guardado dentro del propio objeto (sin memoria dinámica).
+// Ocupa N+1 bytes: N bytes de datos y 1 byte con la longitud usada.
+// No tiene constructores propios para seguir siendo un agregado trivialmente copiable:
+// una colección de estos textos se puede copiar o escribir con un solo memcpy/write.
+template <size_t N>
+struct FixedString {
+    static_assert(N > 0 && N < 256, "La longitud se guarda en un solo byte");
+
+    char datos[N];        // Bytes del texto; el resto queda en cero
+    unsigned char largo;  // Bytes usados (0..N)
+
+    static constexpr size_t capacidad() { return N; }
+
+    // Copia el texto; si excede N bytes se trunca.
+    // El relleno en cero deja los bytes sobrantes deterministas (archivos y memcmp reproducibles).
+    void asignar(const char* texto, size_t n) {
+        n = std::min(n, N);
+        std::memcpy(datos, texto, n);
+        std::memset(datos + n, 0, N - n);
+        largo = static_cast<unsigned char>(n);
+    }
+    void asignar(std::string_view texto) { asignar(texto.data(), texto.size()); }
+
+    size_t size() const { return largo; }
+    bool empty() const { return largo == 0; }
+
+    // Vista sin copia y conversión explícita a std::string
+    std::string_view vista() const { return std::string_view(datos, largo); }
+    std::string str() const { return std::string(datos, largo); }
+
+    bool operator==(std::string_view otro) const { return vista() == otro; }
+    bool operator!=(std::string_view otro) const { return vista() != otro; }
+};
+
+template <size_t N>
+inline std::ostream& operator<<(std::ostream& salida, const FixedString<N>& texto) {
+    return salida.write(texto.datos, texto.largo);
+}
+
+static_assert(std::is_trivially_copyable<FixedString<15>>::value, "FixedString debe copiarse con memcpy");
+static_assert(std::is_standard_layout<FixedString<15>>::value, "FixedString debe tener disposición estándar");
+static_assert(sizeof(FixedString<15>) == 16, "FixedString<N> ocupa N+1 bytes");
+
+#endif // TEXTO_FIJO_H